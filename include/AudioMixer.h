@@ -0,0 +1,152 @@
+// AudioMixer.h - Small multi-voice synth mixer for sound effects
+//
+// Effects are short note lists stored in flash (a few bytes per note) and
+// synthesized on the fly: a 32-bit phase accumulator per voice, a basic
+// waveform and a linear decay per note. render() fills a block of signed
+// 16-bit mono samples and never allocates or blocks, so it can run from the
+// audio task while the main loop triggers effects. No hardware in here.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MIXER_VOICES 4
+
+enum Waveform : uint8_t {
+    WAVE_SQUARE,
+    WAVE_TRIANGLE,
+    WAVE_SAW,
+    WAVE_NOISE
+};
+
+struct SfxNote {
+    uint16_t freqHz;     // 0 = rest
+    uint16_t ms;
+    uint8_t wave;        // Waveform
+    uint8_t volume;      // 0-255, decays linearly to 0 over the note
+};
+
+struct Sfx {
+    const SfxNote* notes;
+    uint8_t count;
+};
+
+class AudioMixer {
+public:
+    explicit AudioMixer(uint32_t sampleRate) : voices{}, sampleRate(sampleRate), noise(0xACE1), clock(0) {}
+
+    // Starts an effect on a free voice, or steals the one that started first
+    void play(const Sfx* sfx) {
+        if (!sfx || sfx->count == 0) return;
+
+        Voice* target = &voices[0];
+        for (uint8_t i = 0; i < MIXER_VOICES; i++) {
+            if (!voices[i].sfx) {
+                target = &voices[i];
+                break;
+            }
+            if (voices[i].started < target->started) target = &voices[i];
+        }
+
+        // From the top of the wave, so an effect sounds the same every time
+        target->sfx = sfx;
+        target->started = ++clock;
+        target->phase = 0;
+        startNote(*target, 0);
+    }
+
+    void stopAll() {
+        for (uint8_t i = 0; i < MIXER_VOICES; i++) voices[i].sfx = nullptr;
+    }
+
+    uint8_t activeVoices() const {
+        uint8_t n = 0;
+        for (uint8_t i = 0; i < MIXER_VOICES; i++) {
+            if (voices[i].sfx) n++;
+        }
+        return n;
+    }
+
+    // Mixes the next count samples into out (overwritten, not added to)
+    void render(int16_t* out, size_t count) {
+        for (size_t s = 0; s < count; s++) {
+            int32_t mix = 0;
+            for (uint8_t i = 0; i < MIXER_VOICES; i++) {
+                Voice& v = voices[i];
+                if (!v.sfx) continue;
+
+                if (v.left == 0) {
+                    if (v.note + 1 >= v.sfx->count) {
+                        v.sfx = nullptr;
+                        continue;
+                    }
+                    startNote(v, v.note + 1);
+                }
+
+                const SfxNote& n = v.sfx->notes[v.note];
+                if (n.freqHz != 0) {
+                    // Amplitude falls from volume to 0 across the note
+                    int32_t amp = (int32_t)n.volume * v.left / v.length;
+                    mix += (waveSample(v, n.wave) * amp) >> 8;
+                    v.phase += v.step;
+                }
+                v.left--;
+            }
+
+            // Leave headroom for a couple of voices, then clip
+            mix >>= 1;
+            if (mix > INT16_MAX) mix = INT16_MAX;
+            if (mix < INT16_MIN) mix = INT16_MIN;
+            out[s] = (int16_t)mix;
+        }
+    }
+
+private:
+    struct Voice {
+        const Sfx* sfx;
+        uint8_t note;
+        uint32_t phase;
+        uint32_t step;       // Phase increment per sample
+        uint32_t left;       // Samples left in this note
+        uint32_t length;
+        uint32_t started;    // For stealing the oldest voice
+    };
+
+    void startNote(Voice& v, uint8_t index) {
+        const SfxNote& n = v.sfx->notes[index];
+        v.note = index;
+        v.step = (uint32_t)(((uint64_t)n.freqHz << 32) / sampleRate);
+        v.length = (uint32_t)n.ms * sampleRate / 1000;
+        if (v.length == 0) v.length = 1;
+        v.left = v.length;
+    }
+
+    // Full-scale signed 16-bit sample for the voice's current phase
+    int32_t waveSample(Voice& v, uint8_t wave) {
+        switch (wave) {
+            case WAVE_SQUARE:
+                return (v.phase & 0x80000000u) ? 32767 : -32767;
+            case WAVE_TRIANGLE: {
+                int32_t ramp = (int32_t)(v.phase >> 15) - 65536;   // -65536..65535
+                return (ramp < 0 ? -ramp : ramp) - 32768;
+            }
+            case WAVE_SAW:
+                return (int32_t)(v.phase >> 16) - 32768;
+            default: {
+                // New noise value once per wave cycle, so pitch still matters
+                if (v.phase < v.step) {
+                    noise ^= noise << 7;
+                    noise ^= noise >> 9;
+                    noise ^= noise << 8;
+                }
+                return (int16_t)noise;
+            }
+        }
+    }
+
+    Voice voices[MIXER_VOICES];
+    uint32_t sampleRate;
+    uint16_t noise;
+    uint32_t clock;
+};
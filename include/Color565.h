@@ -0,0 +1,69 @@
+// Color565.h - Integer RGB565 color math
+//
+// Blends, fades and glows without unpacking to floats. A color is spread
+// into 32 bits as 00000GGGGGG00000RRRRR000000BBBBB: green moves to the top
+// half so every channel has spare bits above it. One multiply then scales
+// all three channels at once, and one add sums them, with carries landing
+// in the gaps instead of the neighboring channel.
+//
+// Fades use 32 steps - as fine as the 5-bit red and blue channels can show.
+// Everything is constexpr, so fade tables for fixed colors are built at
+// compile time and live in flash.
+
+#pragma once
+
+#include <stdint.h>
+
+#define COLOR_FADE_STEPS 32
+
+constexpr uint32_t color565Spread(uint16_t c) {
+    return (c | ((uint32_t)c << 16)) & 0x07E0F81F;
+}
+
+constexpr uint16_t color565Pack(uint32_t spread) {
+    return (uint16_t)((spread & 0xF81F) | ((spread >> 16) & 0x07E0));
+}
+
+// step 0 gives from, COLOR_FADE_STEPS gives to
+constexpr uint16_t color565Lerp(uint16_t from, uint16_t to, uint8_t step) {
+    return color565Pack((color565Spread(from) * (COLOR_FADE_STEPS - step) +
+                         color565Spread(to) * step) >> 5);
+}
+
+// level 0 is black, COLOR_FADE_STEPS is the color unchanged
+constexpr uint16_t color565Scale(uint16_t c, uint8_t level) {
+    return color565Pack((color565Spread(c) * level) >> 5);
+}
+
+// 8-bit alpha (anti-aliased glyph coverage), rounded to the nearest step
+constexpr uint16_t color565Blend(uint16_t fg, uint16_t bg, uint8_t alpha) {
+    return color565Lerp(bg, fg, (uint8_t)((alpha + 4) >> 3));
+}
+
+// Per-channel add that clips at full brightness instead of wrapping - for
+// glows and highlights
+constexpr uint16_t color565AddSat(uint16_t a, uint16_t b) {
+    uint32_t sum = color565Spread(a) + color565Spread(b);
+    uint32_t carry5 = sum & 0x00010020;     // Out of red and blue
+    uint32_t carry6 = sum & 0x08000000;     // Out of green
+    uint32_t clip = (carry5 - (carry5 >> 5)) | (carry6 - (carry6 >> 6));
+    return color565Pack((sum | clip) & 0x07E0F81F);
+}
+
+// Every step from one color to another, for stepping an effect frame by
+// frame without doing the math each time
+struct ColorFade {
+    uint16_t steps[COLOR_FADE_STEPS + 1];
+
+    constexpr uint16_t operator[](uint8_t step) const {
+        return steps[step > COLOR_FADE_STEPS ? COLOR_FADE_STEPS : step];
+    }
+};
+
+constexpr ColorFade makeColorFade(uint16_t from, uint16_t to) {
+    ColorFade fade{};
+    for (uint8_t i = 0; i <= COLOR_FADE_STEPS; i++) {
+        fade.steps[i] = color565Lerp(from, to, i);
+    }
+    return fade;
+}
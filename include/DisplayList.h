@@ -0,0 +1,104 @@
+// DisplayList.h - Records a frame's draw calls and trims them before sending
+//
+// A TFT_eSPI that never touches the bus itself: the leaf draw calls that
+// every TFT_eSPI primitive funnels into (fills, lines, glyphs) and windows
+// of ready-made pixels are recorded into a fixed array. submit() then walks the list backwards to drop anything
+// a later opaque fill covers completely, folds neighboring same-color
+// fills into one, and replays what is left on the panel inside a single
+// startWrite()/endWrite() transaction.
+//
+// Painter's-order screens benefit most: fillScreen() followed by boxes and
+// buttons sends the background only once per pixel the UI leaves showing.
+
+#pragma once
+
+#include <TFT_eSPI.h>
+
+#define DISPLAY_LIST_OPS 512          // Recorded calls before an early submit
+#define DISPLAY_LIST_OCCLUDERS 24     // Largest opaque fills used for culling
+#define DISPLAY_LIST_MIN_OCCLUDER 64  // Pixels - smaller fills hide too little
+#define DISPLAY_LIST_WINDOW_BYTES 11  // CASET + RASET + RAMWR per primitive
+
+// Counts since the last takeCounters()
+struct DisplayListCounters {
+    uint32_t recorded;
+    uint32_t culled;          // Fully covered by a later fill
+    uint32_t merged;          // Folded into the fill before it
+    uint32_t submitted;
+    uint32_t bytesCulled;     // Pixel bytes of culled fills and opaque glyphs
+    uint32_t bytesMerged;     // Window setup and overlap bytes saved by merging
+};
+
+class DisplayList : public TFT_eSPI {
+public:
+    explicit DisplayList(TFT_eSPI* target);
+
+    // Copies the target's size and rotation - call after the panel is set up
+    void begin();
+
+    // Optimizes and sends everything recorded so far
+    void submit();
+
+    // Something opaque is about to go straight to the panel over this area:
+    // recorded calls it hides are dropped, and if any left overlap it the
+    // list is sent first so they stay underneath
+    void occlude(int32_t x, int32_t y, int32_t w, int32_t h);
+
+    // Records a window of RGB565 pixels (panel byte order). Only the pointer
+    // is kept - the pixels must stay as they are until the next submit().
+    void pushWindow(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* pixels);
+
+    DisplayListCounters takeCounters();
+    uint16_t pending() const { return count; }
+
+    // Recorded instead of drawn
+    void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+    void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) override;
+    void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) override;
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override;
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override;
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+
+    int16_t width() override { return _width; }
+    int16_t height() override { return _height; }
+
+private:
+    enum OpType : uint8_t { OP_FILL, OP_CHAR, OP_LINE, OP_PIXELS, OP_DEAD };
+
+    // x/y/w/h bound the pixels the call can touch
+    struct Op {
+        uint8_t type;
+        uint8_t size;         // Glyph scale
+        uint16_t color;
+        int16_t x, y, w, h;
+        union {
+            struct {
+                uint16_t code;
+                uint16_t bg;  // == color for transparent text
+            } glyph;
+            struct {
+                int16_t xs, ys, xe, ye;
+            } line;
+            const uint16_t* pixels;
+        };
+    };
+
+    struct Rect {
+        int16_t x, y, w, h;
+    };
+
+    Op* add();
+    void addFill(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void cull();
+    void merge();
+    void replay();
+
+    static bool contains(const Rect& outer, const Op& op);
+    static bool overlaps(const Rect& area, const Op& op);
+    static uint32_t opBytes(const Op& op);
+
+    TFT_eSPI* target;
+    Op ops[DISPLAY_LIST_OPS];
+    uint16_t count;
+    DisplayListCounters counters;
+};
@@ -0,0 +1,198 @@
+// FactGenerator.h - Arithmetic fact questions for any operation
+//
+// Each operation is a policy struct: how a pair of table operands (1-12)
+// becomes a fact, its symbol, and how to make plausible wrong answers. Every
+// fact for an operation is built at compile time into a constexpr table, so
+// asking a question is a table lookup. FactGenerator<Op> is instantiated
+// once per enabled operation and picked when the game starts - nothing in
+// the per-question path branches on the operation, and an operation that is
+// never instantiated never reaches the binary.
+
+#pragma once
+
+#include <stdint.h>
+
+#define FACT_MIN 1
+#define FACT_MAX 12
+#define FACT_RANGE (FACT_MAX - FACT_MIN + 1)
+#define FACT_COUNT (FACT_RANGE * FACT_RANGE)
+#define FACT_ANSWERS 4
+#define FACT_MAX_DISTRACTORS 8
+
+struct Fact {
+    int16_t left;        // Shown as "left op right = ?"
+    int16_t right;
+    int16_t answer;
+    uint8_t table;       // Which 1-12 table the fact belongs to
+};
+
+struct Question {
+    int num1;
+    int num2;
+    char symbol;
+    int correctAnswer;
+    int answers[FACT_ANSWERS];
+    int correctIndex;
+    uint8_t table;
+    uint8_t fact;        // Index into the fact table, row * FACT_RANGE + column
+};
+
+// ---- Operation policies ----
+// fact(a, b) builds the fact for table operands a and b. distractors() writes
+// candidate wrong answers (may include duplicates or the right answer - the
+// generator filters those) and returns how many.
+
+struct AddOp {
+    static constexpr char symbol = '+';
+    static constexpr Fact fact(int a, int b) {
+        return Fact{(int16_t)a, (int16_t)b, (int16_t)(a + b), (uint8_t)(a < b ? a : b)};
+    }
+    static int distractors(const Fact& f, int* out) {
+        int n = 0;
+        out[n++] = f.answer - 1;
+        out[n++] = f.answer + 1;
+        out[n++] = f.answer - 2;
+        out[n++] = f.answer + 2;
+        out[n++] = f.answer + 10;            // Carried into the tens
+        out[n++] = f.left > f.right ? f.left - f.right : f.right - f.left;  // Subtracted
+        return n;
+    }
+};
+
+// (a + b) - b = a
+struct SubOp {
+    static constexpr char symbol = '-';
+    static constexpr Fact fact(int a, int b) {
+        return Fact{(int16_t)(a + b), (int16_t)b, (int16_t)a, (uint8_t)b};
+    }
+    static int distractors(const Fact& f, int* out) {
+        int n = 0;
+        out[n++] = f.answer - 1;
+        out[n++] = f.answer + 1;
+        out[n++] = f.answer - 2;
+        out[n++] = f.answer + 2;
+        out[n++] = f.right;                  // Answered with the number taken away
+        out[n++] = f.left + f.right;         // Added instead
+        return n;
+    }
+};
+
+struct MulOp {
+    static constexpr char symbol = 'x';
+    static constexpr Fact fact(int a, int b) {
+        return Fact{(int16_t)a, (int16_t)b, (int16_t)(a * b), (uint8_t)(a < b ? a : b)};
+    }
+    static int distractors(const Fact& f, int* out) {
+        int n = 0;
+        // Near misses
+        out[n++] = f.answer - 1;
+        out[n++] = f.answer + 1;
+        out[n++] = f.answer - 2;
+        out[n++] = f.answer + 2;
+        // Answers from adjacent tables
+        out[n++] = f.left * (f.right + 1);
+        out[n++] = f.left * (f.right - 1);
+        out[n++] = (f.left + 1) * f.right;
+        out[n++] = (f.left - 1) * f.right;
+        return n;
+    }
+};
+
+// (a * b) / b = a
+struct DivOp {
+    static constexpr char symbol = '/';
+    static constexpr Fact fact(int a, int b) {
+        return Fact{(int16_t)(a * b), (int16_t)b, (int16_t)a, (uint8_t)b};
+    }
+    static int distractors(const Fact& f, int* out) {
+        int n = 0;
+        out[n++] = f.answer - 1;
+        out[n++] = f.answer + 1;
+        out[n++] = f.answer - 2;
+        out[n++] = f.answer + 2;
+        out[n++] = f.right;                  // Answered with the divisor
+        out[n++] = f.right + 1;
+        return n;
+    }
+};
+
+// ---- Compile-time fact tables ----
+
+template <class Op>
+struct FactTable {
+    struct Facts {
+        Fact items[FACT_COUNT];
+    };
+
+    static constexpr Facts build() {
+        Facts facts{};
+        for (int a = 0; a < FACT_RANGE; a++) {
+            for (int b = 0; b < FACT_RANGE; b++) {
+                facts.items[a * FACT_RANGE + b] = Op::fact(a + FACT_MIN, b + FACT_MIN);
+            }
+        }
+        return facts;
+    }
+
+    static constexpr Facts facts = build();
+};
+
+// ---- Generator ----
+
+template <class Op>
+struct FactGenerator {
+    // random(n) must return 0..n-1
+    template <class Random>
+    static void generate(Question& q, Random&& random) {
+        int index = random(FACT_COUNT);
+        const Fact& f = FactTable<Op>::facts.items[index];
+        q.fact = index;
+        q.num1 = f.left;
+        q.num2 = f.right;
+        q.symbol = Op::symbol;
+        q.correctAnswer = f.answer;
+        q.table = f.table;
+
+        int wrong[FACT_MAX_DISTRACTORS];
+        int wrongCount = Op::distractors(f, wrong);
+
+        // Shuffle wrong answers
+        for (int i = wrongCount - 1; i > 0; i--) {
+            int j = random(i + 1);
+            int temp = wrong[i];
+            wrong[i] = wrong[j];
+            wrong[j] = temp;
+        }
+
+        // Place correct answer randomly, fill the rest with unique positives
+        q.correctIndex = random(FACT_ANSWERS);
+        int wrongIdx = 0;
+        for (int i = 0; i < FACT_ANSWERS; i++) {
+            if (i == q.correctIndex) {
+                q.answers[i] = q.correctAnswer;
+                continue;
+            }
+
+            int answer;
+            bool valid;
+            do {
+                valid = true;
+                answer = wrong[wrongIdx++ % wrongCount];
+                if (answer == q.correctAnswer || answer <= 0) valid = false;
+                for (int j = 0; j < i; j++) {
+                    if (q.answers[j] == answer) valid = false;
+                }
+            } while (!valid && wrongIdx < 20);
+
+            // Ran out of candidates - count upwards from the answer instead
+            while (!valid) {
+                answer = q.correctAnswer + wrongIdx++ - 18;
+                valid = answer > 0 && answer != q.correctAnswer;
+                for (int j = 0; j < i; j++) {
+                    if (q.answers[j] == answer) valid = false;
+                }
+            }
+            q.answers[i] = answer;
+        }
+    }
+};
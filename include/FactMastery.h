@@ -0,0 +1,148 @@
+// FactMastery.h - How well each of the 144 facts is known
+//
+// One small record per fact (right, wrong, a running average answer time)
+// and the mastery level it works out to. The level is updated on every
+// answer, along with a count of facts at each level, so the stats screen
+// only ever reads finished values - nothing is scanned when it opens.
+//
+// Records are packed into two bytes each and saved and loaded as one 288-byte
+// NVS blob - 16 of them (4 profiles x 4 operations) have to share a 20 KB
+// partition. Counts halve together when one fills up, so old answers fade
+// out and the ratio holds.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "FactGenerator.h"
+
+#define FACT_FAST_MS 3000           // Right and this quick counts as mastered
+#define FACT_COUNT_MAX 31           // Right or wrong answers kept before halving
+#define FACT_SPEED_STEP_MS 100      // Average answer time is kept in these steps
+#define FACT_SPEED_MAX 63           // 6.3 s - anything slower reads as this
+
+enum MasteryLevel : uint8_t {
+    MASTERY_UNSEEN,
+    MASTERY_WEAK,                   // Under half right
+    MASTERY_SHAKY,                  // Under 3 in 4
+    MASTERY_CLOSE,                  // Under 9 in 10
+    MASTERY_SLOW,                   // Right, but slower than FACT_FAST_MS
+    MASTERY_MASTERED,
+    NUM_MASTERY_LEVELS
+};
+
+struct __attribute__((packed)) FactRecord {
+    uint16_t correct : 5;
+    uint16_t wrong : 5;
+    uint16_t speed : 6;             // Average of correct answers in steps, 0 = none yet
+};
+static_assert(sizeof(FactRecord) == 2, "FactRecord layout changed - update the NVS budget");
+
+// The record saved by earlier firmware, 576 bytes for all the facts.
+// loadedV1() converts it.
+struct FactRecordV1 {
+    uint8_t correct;
+    uint8_t wrong;
+    uint16_t avgMs;
+};
+
+class FactMastery {
+public:
+    FactMastery() { clear(); }
+
+    void clear() {
+        memset(records, 0, sizeof(records));
+        memset(levels, MASTERY_UNSEEN, sizeof(levels));
+        memset(counts, 0, sizeof(counts));
+        counts[MASTERY_UNSEEN] = FACT_COUNT;
+        changed = false;
+    }
+
+    void record(uint8_t fact, bool correct, uint32_t ms) {
+        if (fact >= FACT_COUNT) return;
+        FactRecord& r = records[fact];
+        if (r.correct == FACT_COUNT_MAX || r.wrong == FACT_COUNT_MAX) {
+            r.correct = (r.correct + 1) / 2;
+            r.wrong = (r.wrong + 1) / 2;
+        }
+        if (correct) {
+            if (ms > FACT_SPEED_MAX * FACT_SPEED_STEP_MS) ms = FACT_SPEED_MAX * FACT_SPEED_STEP_MS;
+            // Running average weighted 1/4 toward the newest answer
+            int32_t avgMs = r.speed * FACT_SPEED_STEP_MS;
+            avgMs = r.correct == 0 ? ms : avgMs + ((int32_t)ms - avgMs) / 4;
+            r.speed = speedOf(avgMs);
+            r.correct++;
+        } else {
+            r.wrong++;
+        }
+        setLevel(fact, levelOf(r));
+        changed = true;
+    }
+
+    uint8_t level(uint8_t fact) const { return levels[fact]; }
+    uint8_t countAt(uint8_t level) const { return counts[level]; }
+
+    // Saving and loading: the records as raw bytes. Call loaded() after
+    // writing into them.
+    FactRecord* data() { return records; }
+    static constexpr size_t dataSize() { return sizeof(FactRecord) * FACT_COUNT; }
+
+    // From a version 1 blob: counts over FACT_COUNT_MAX halve until they fit
+    static constexpr size_t dataSizeV1() { return sizeof(FactRecordV1) * FACT_COUNT; }
+    void loadedV1(const FactRecordV1* old) {
+        for (int i = 0; i < FACT_COUNT; i++) {
+            uint8_t correct = old[i].correct, wrong = old[i].wrong;
+            while (correct > FACT_COUNT_MAX || wrong > FACT_COUNT_MAX) {
+                correct = (correct + 1) / 2;
+                wrong = (wrong + 1) / 2;
+            }
+            records[i].correct = correct;
+            records[i].wrong = wrong;
+            records[i].speed = correct ? speedOf(old[i].avgMs) : 0;
+        }
+        loaded();
+        changed = true;             // Saved in the new layout at the next save
+    }
+
+    void loaded() {
+        memset(counts, 0, sizeof(counts));
+        for (int i = 0; i < FACT_COUNT; i++) {
+            levels[i] = levelOf(records[i]);
+            counts[levels[i]]++;
+        }
+        changed = false;
+    }
+
+    // Answers recorded since the last save
+    bool dirty() const { return changed; }
+    void saved() { changed = false; }
+
+    static uint8_t levelOf(const FactRecord& r) {
+        uint16_t answers = r.correct + r.wrong;
+        if (answers == 0) return MASTERY_UNSEEN;
+        if (r.correct * 2 < answers) return MASTERY_WEAK;
+        if (r.correct * 4 < answers * 3) return MASTERY_SHAKY;
+        if (r.correct * 10 < answers * 9) return MASTERY_CLOSE;
+        return r.speed * FACT_SPEED_STEP_MS > FACT_FAST_MS ? MASTERY_SLOW : MASTERY_MASTERED;
+    }
+
+    // Nearest step, never 0 once there is an answer
+    static uint8_t speedOf(uint32_t ms) {
+        uint32_t speed = (ms + FACT_SPEED_STEP_MS / 2) / FACT_SPEED_STEP_MS;
+        if (speed < 1) return 1;
+        return speed > FACT_SPEED_MAX ? FACT_SPEED_MAX : speed;
+    }
+
+private:
+    void setLevel(uint8_t fact, uint8_t level) {
+        counts[levels[fact]]--;
+        counts[level]++;
+        levels[fact] = level;
+    }
+
+    FactRecord records[FACT_COUNT];
+    uint8_t levels[FACT_COUNT];
+    uint8_t counts[NUM_MASTERY_LEVELS];
+    bool changed;
+};
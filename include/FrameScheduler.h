@@ -0,0 +1,104 @@
+// FrameScheduler.h - Fixed-timestep frame pacing with a per-frame budget
+//
+// Physics advances in whole fixed steps from an accumulator, so simulation
+// speed no longer depends on how long rendering takes. Each frame renders
+// once after its steps. Work is tagged with a priority. Once a frame has
+// used most of its budget, or the previous frame overran, low-priority work
+// (extra particles, decorative redraws) is shed. Input and feedback never are.
+
+#pragma once
+
+#include <stdint.h>
+
+enum FramePriority : uint8_t {
+    PRIO_INPUT,      // Touch handling - never shed
+    PRIO_FEEDBACK,   // Answer feedback drawing - never shed
+    PRIO_DECOR       // Extra particles, decorative redraws
+};
+
+struct FrameStats {
+    uint32_t frames;
+    uint32_t overruns;       // Frames that took longer than the budget
+    uint32_t shed;           // Low-priority jobs skipped
+    uint32_t droppedSteps;   // Physics steps lost to the catch-up cap
+    uint32_t lastFrameUs;
+    uint32_t worstFrameUs;
+};
+
+class FrameScheduler {
+public:
+    FrameScheduler(uint32_t stepUs, uint32_t budgetUs, uint8_t maxSteps)
+        : stepUs(stepUs), budgetUs(budgetUs), maxSteps(maxSteps),
+          lastTickUs(0), accumulatorUs(0), frameStartUs(0), lastOverran(false), stats() {}
+
+    bool due(int64_t nowUs) const {
+        return accumulatorUs + (nowUs - lastTickUs) >= (int64_t)stepUs;
+    }
+
+    // Microseconds until the next frame is due (0 if already due)
+    int64_t untilDueUs(int64_t nowUs) const {
+        int64_t left = (int64_t)stepUs - accumulatorUs - (nowUs - lastTickUs);
+        return left > 0 ? left : 0;
+    }
+
+    // Starts a frame and returns how many physics steps to run. If nothing was
+    // animating last frame there is nothing to catch up on, so idle time
+    // (e.g. light sleep) is not counted as dropped steps.
+    uint8_t beginFrame(int64_t nowUs, bool wasAnimating) {
+        accumulatorUs += nowUs - lastTickUs;
+        lastTickUs = nowUs;
+        frameStartUs = nowUs;
+
+        if (!wasAnimating) {
+            accumulatorUs = 0;
+            return 1;
+        }
+
+        uint32_t steps = accumulatorUs / stepUs;
+        accumulatorUs -= (int64_t)steps * stepUs;
+        if (steps > maxSteps) {
+            stats.droppedSteps += steps - maxSteps;
+            steps = maxSteps;
+        }
+        return steps;
+    }
+
+    // Ask before doing work of the given priority this frame
+    bool allow(FramePriority priority, int64_t nowUs) {
+        if (priority != PRIO_DECOR) return true;
+
+        bool ok = !lastOverran && (nowUs - frameStartUs) < (int64_t)(budgetUs * 3 / 4);
+        if (!ok) stats.shed++;
+        return ok;
+    }
+
+    void endFrame(int64_t nowUs) {
+        uint32_t frameUs = nowUs - frameStartUs;
+        stats.frames++;
+        stats.lastFrameUs = frameUs;
+        if (frameUs > stats.worstFrameUs) stats.worstFrameUs = frameUs;
+
+        lastOverran = frameUs > budgetUs;
+        if (lastOverran) stats.overruns++;
+    }
+
+    // Time spent outside the game (e.g. a screenshot) that physics should
+    // not catch up on
+    void skip(int64_t us) {
+        lastTickUs += us;
+    }
+
+    const FrameStats& getStats() const { return stats; }
+    void resetStats() { stats = FrameStats(); }
+    uint32_t budget() const { return budgetUs; }
+
+private:
+    uint32_t stepUs;
+    uint32_t budgetUs;
+    uint8_t maxSteps;
+    int64_t lastTickUs;
+    int64_t accumulatorUs;
+    int64_t frameStartUs;
+    bool lastOverran;
+    FrameStats stats;
+};
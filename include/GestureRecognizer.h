@@ -0,0 +1,163 @@
+// GestureRecognizer.h - Tap, double-tap, long-press, swipe and drag from touch samples
+//
+// Fed one (pressed, x, y, time) sample per poll, the recognizer tracks a
+// single finger through press, move and release and reports a Gesture when
+// one completes. Taps are reported on release with no wait for a possible
+// second tap - the second tap of a quick pair is reported as DOUBLE_TAP
+// instead. Long-press fires while the finger is still down. A press that
+// wanders off but is no swipe ends as a drag. Swipe velocity is a running
+// average of the last few moves in integer pixels per second.
+// Fixed size, no allocation, a handful of integer operations per sample.
+
+#pragma once
+
+#include <stdint.h>
+
+#define GESTURE_SLOP_PX 12           // Travel that still counts as holding still
+#define GESTURE_LONG_PRESS_MS 800
+#define GESTURE_DOUBLE_TAP_MS 300    // Release to next press
+#define GESTURE_SWIPE_MIN_PX 40      // Along the main axis
+#define GESTURE_SWIPE_MIN_SPEED 250  // px/s along the main axis at release
+
+enum GestureType : uint8_t {
+    GESTURE_TAP,
+    GESTURE_DOUBLE_TAP,
+    GESTURE_LONG_PRESS,
+    GESTURE_SWIPE,
+    GESTURE_DRAG                    // Moved further than a tap, but not a swipe
+};
+
+enum SwipeDirection : uint8_t {
+    SWIPE_NONE,
+    SWIPE_LEFT,
+    SWIPE_RIGHT,
+    SWIPE_UP,
+    SWIPE_DOWN
+};
+
+struct Gesture {
+    uint8_t type;          // GestureType
+    uint8_t direction;     // SwipeDirection, swipes only
+    int16_t x, y;          // Where the press started
+    int16_t dx, dy;        // Travel from press to release
+    int32_t vx, vy;        // Velocity at release, px/s
+};
+
+class GestureRecognizer {
+public:
+    GestureRecognizer()
+        : state(IDLE), startX(0), startY(0), lastX(0), lastY(0),
+          startMs(0), lastMs(0), vx(0), vy(0),
+          lastTapMs(0), lastTapX(0), lastTapY(0), haveTap(false) {}
+
+    // Returns true and fills out when a gesture completes on this sample.
+    // x and y are ignored while not pressed.
+    bool update(bool pressed, int x, int y, uint32_t nowMs, Gesture& out) {
+        if (state == IDLE) {
+            if (!pressed) return false;
+            state = HOLDING;
+            startX = lastX = x;
+            startY = lastY = y;
+            startMs = lastMs = nowMs;
+            vx = vy = 0;
+            return false;
+        }
+
+        if (pressed) {
+            track(x, y, nowMs);
+            if (state == HOLDING) {
+                if (outside(x - startX, y - startY, GESTURE_SLOP_PX)) {
+                    state = MOVING;
+                } else if (nowMs - startMs >= GESTURE_LONG_PRESS_MS) {
+                    state = LONG_PRESSED;
+                    fill(out, GESTURE_LONG_PRESS, SWIPE_NONE);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Released - the last sample position stands as the end point
+        State ended = state;
+        state = IDLE;
+        if (ended == LONG_PRESSED) return false;
+
+        if (ended == MOVING) {
+            uint8_t dir = swipeDirection();
+            if (dir != SWIPE_NONE) {
+                haveTap = false;
+                fill(out, GESTURE_SWIPE, dir);
+                return true;
+            }
+            // Drifted, but not far enough to mean anything else - a sloppy tap
+            if (outside(lastX - startX, lastY - startY, GESTURE_SWIPE_MIN_PX)) {
+                haveTap = false;
+                fill(out, GESTURE_DRAG, SWIPE_NONE);
+                return true;
+            }
+        }
+
+        bool isDouble = haveTap && startMs - lastTapMs <= GESTURE_DOUBLE_TAP_MS &&
+                        !outside(startX - lastTapX, startY - lastTapY, 2 * GESTURE_SLOP_PX);
+        // A third quick tap starts a new pair rather than chaining
+        haveTap = !isDouble;
+        lastTapMs = nowMs;
+        lastTapX = startX;
+        lastTapY = startY;
+        fill(out, isDouble ? GESTURE_DOUBLE_TAP : GESTURE_TAP, SWIPE_NONE);
+        return true;
+    }
+
+    bool active() const { return state != IDLE; }
+
+private:
+    enum State : uint8_t { IDLE, HOLDING, MOVING, LONG_PRESSED };
+
+    static bool outside(int32_t dx, int32_t dy, int32_t limit) {
+        return dx > limit || dx < -limit || dy > limit || dy < -limit;
+    }
+
+    // Velocity of this move, averaged 1:1 with the running value
+    void track(int x, int y, uint32_t nowMs) {
+        uint32_t dt = nowMs - lastMs;
+        if (dt == 0) return;
+        vx = (vx + (int32_t)(x - lastX) * 1000 / (int32_t)dt) / 2;
+        vy = (vy + (int32_t)(y - lastY) * 1000 / (int32_t)dt) / 2;
+        lastX = x;
+        lastY = y;
+        lastMs = nowMs;
+    }
+
+    uint8_t swipeDirection() const {
+        int32_t dx = lastX - startX, dy = lastY - startY;
+        int32_t adx = dx < 0 ? -dx : dx, ady = dy < 0 ? -dy : dy;
+        if (adx >= ady) {
+            int32_t speed = dx < 0 ? -vx : vx;
+            if (adx < GESTURE_SWIPE_MIN_PX || speed < GESTURE_SWIPE_MIN_SPEED) return SWIPE_NONE;
+            return dx < 0 ? SWIPE_LEFT : SWIPE_RIGHT;
+        }
+        int32_t speed = dy < 0 ? -vy : vy;
+        if (ady < GESTURE_SWIPE_MIN_PX || speed < GESTURE_SWIPE_MIN_SPEED) return SWIPE_NONE;
+        return dy < 0 ? SWIPE_UP : SWIPE_DOWN;
+    }
+
+    void fill(Gesture& out, uint8_t type, uint8_t direction) const {
+        out.type = type;
+        out.direction = direction;
+        out.x = startX;
+        out.y = startY;
+        out.dx = lastX - startX;
+        out.dy = lastY - startY;
+        out.vx = vx;
+        out.vy = vy;
+    }
+
+    State state;
+    int16_t startX, startY;
+    int16_t lastX, lastY;
+    uint32_t startMs, lastMs;
+    int32_t vx, vy;
+    uint32_t lastTapMs;
+    int16_t lastTapX, lastTapY;
+    bool haveTap;
+};
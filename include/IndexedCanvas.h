@@ -0,0 +1,73 @@
+// IndexedCanvas.h - Full-screen 4-bpp palette framebuffer
+//
+// A 320x240 RGB565 framebuffer (150 KB) does not fit comfortably in the
+// ESP32's DRAM, but the UI only uses a handful of colors. This canvas keeps
+// 4 bits per pixel (38 KB) and takes normal RGB565 drawing calls, mapping
+// each color to its palette slot. flush() expands the dirty parts to RGB565
+// a band of lines at a time, double-buffered behind DMA, so there is never
+// a full-frame 16-bit allocation.
+//
+// Palette effects (screen flashes, fades) change the palette and re-push
+// only the area they affect, with no primitive redrawn.
+
+#pragma once
+
+#include <TFT_eSPI.h>
+
+#define CANVAS_WIDTH 320
+#define CANVAS_HEIGHT 240
+#define CANVAS_BAND_LINES 8
+#define CANVAS_PALETTE_SIZE 16
+
+class IndexedCanvas : public TFT_eSprite {
+public:
+    explicit IndexedCanvas(TFT_eSPI* display);
+
+    // Allocates the framebuffer and line buffers. Returns false if out of RAM.
+    bool begin(const uint16_t* palette);
+
+    // Push every dirty band to the panel
+    void flush();
+
+    // Palette effects - take effect on the next flush. One slot re-pushes
+    // only the given area; pixels of that slot outside it keep their old
+    // color on the panel until something there is drawn again.
+    void setPaletteEntry(uint8_t index, uint16_t color, int32_t x, int32_t y, int32_t w, int32_t h);
+    void fillPalette(uint16_t color);     // Every slot one color (full-screen flash)
+    void restorePalette();                // Back to the palette given to begin()
+
+    // Nearest palette slot for an RGB565 color
+    uint8_t indexOf(uint16_t color);
+
+    // Blit RGB565 pixels (already in panel byte order) into the canvas
+    void pushImage565(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+    void markDirty(int32_t x, int32_t y, int32_t w, int32_t h);
+    void markAllDirty();
+
+    // Drawing calls arrive in RGB565 and are stored as palette indices.
+    // Only the outermost call translates - the sprite's own internals call
+    // these again with indices, which pass straight through.
+    void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+    void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) override;
+    void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) override;
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override;
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override;
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+
+private:
+    static const int NUM_BANDS = (CANVAS_HEIGHT + CANVAS_BAND_LINES - 1) / CANVAS_BAND_LINES;
+
+    void expandBand(int band, int16_t x0, int16_t x1, uint16_t* out);
+
+    TFT_eSPI* display;
+    uint16_t basePalette[CANVAS_PALETTE_SIZE];
+    uint16_t wirePalette[CANVAS_PALETTE_SIZE];   // Byte-swapped for the panel
+    uint16_t* lineBuffers[2];
+    int16_t dirtyX0[NUM_BANDS];                  // Dirty column span per band
+    int16_t dirtyX1[NUM_BANDS];                  // (x1 < x0 means clean)
+    uint16_t lastColor;
+    uint8_t lastIndex;
+    bool translating;
+    bool dmaReady;
+};
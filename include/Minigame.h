@@ -0,0 +1,42 @@
+// Minigame.h - Plugin interface for games shown on the launcher
+//
+// A minigame is a static descriptor: launcher metadata, init/teardown, the
+// screen states that make up its input and frame hooks, and a Preferences
+// namespace prefix for its saves. Registering a game only copies hooks into
+// the screen machine - nothing is allocated or loaded until init() runs when
+// the game is entered, and teardown() gives it all back on exit.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "ScreenMachine.h"
+
+struct MinigameScreen {
+    uint8_t id;             // GameScreen slot this state occupies
+    ScreenState hooks;
+};
+
+struct Minigame {
+    // Launcher button
+    const char* title;
+    const char* subtitle;
+    const char* iconLeft;   // Small decorations either side of the title
+    const char* iconRight;
+    uint16_t color;
+
+    // Persistence: saves live in "<prefsPrefix>_p<profile>" (max 10 chars)
+    const char* prefsPrefix;
+
+    // Lifecycle - init() allocates assets and loads state, teardown() frees them
+    void (*init)();
+    void (*teardown)();
+
+    // Input and frame hooks, one state per screen
+    const MinigameScreen* screens;
+    size_t numScreens;
+    const ScreenTransition* transitions;
+    size_t numTransitions;
+    uint8_t entryScreen;
+};
@@ -0,0 +1,137 @@
+// RleImage.h - Run-length encoded RGB565 images, a streaming decoder and
+// encoder
+//
+// Images are produced at build time by tools/make_assets.py. The decoder
+// fills any number of pixels per call and picks up where it left off, so a
+// full-screen image can be sent through a couple of small line buffers
+// without ever being decoded whole. The encoder does the same the other way,
+// for screenshots read back from the panel.
+//
+// Stream format: control byte c
+//   c & 0x80 -> (c & 0x7F) + 1 literal pixels follow, 2 bytes each
+//   else     -> c + 1 copies of the next 2-byte pixel
+// Pixels are stored high byte first, i.e. panel order once in memory.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+struct RleImage {
+    uint16_t width;
+    uint16_t height;
+    uint32_t size;          // Compressed bytes
+    const uint8_t* data;
+};
+
+class RleDecoder {
+public:
+    explicit RleDecoder(const RleImage& image)
+        : pos(image.data), end(image.data + image.size),
+          remaining(0), literal(false), runPixel(0) {}
+
+    // Writes up to count pixels in panel byte order. Returns how many were
+    // written - fewer than count only at the end of the image.
+    size_t read(uint16_t* out, size_t count) {
+        size_t written = 0;
+        while (written < count) {
+            if (remaining == 0) {
+                if (pos >= end) break;
+                uint8_t c = *pos++;
+                literal = (c & 0x80) != 0;
+                remaining = (c & 0x7F) + 1;
+                if (!literal) runPixel = pixelAt(pos), pos += 2;
+            }
+
+            size_t n = count - written;
+            if (n > remaining) n = remaining;
+            if (literal) {
+                for (size_t i = 0; i < n; i++, pos += 2) out[written + i] = pixelAt(pos);
+            } else {
+                for (size_t i = 0; i < n; i++) out[written + i] = runPixel;
+            }
+            written += n;
+            remaining -= n;
+        }
+        return written;
+    }
+
+private:
+    // High byte first in the stream -> byte-swapped uint16 in memory
+    static uint16_t pixelAt(const uint8_t* p) {
+        return (uint16_t)(p[0] | (p[1] << 8));
+    }
+
+    const uint8_t* pos;
+    const uint8_t* end;
+    uint16_t remaining;
+    bool literal;
+    uint16_t runPixel;
+};
+
+// Encodes pixels in panel byte order (as readRect() returns them) a few at a
+// time, the same way tools/make_assets.py does: repeats of 2+ become runs,
+// everything else literals. Only one literal group is held (257 bytes);
+// finished groups go to emit() as soon as they are complete.
+class RleEncoder {
+public:
+    typedef void (*Emit)(const uint8_t* bytes, size_t count);
+
+    explicit RleEncoder(Emit emit)
+        : emit(emit), pixel(0), repeats(0), literals(0), total(0) {}
+
+    void write(const uint16_t* pixels, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            if (repeats > 0 && pixels[i] == pixel && repeats < 128) {
+                repeats++;
+                continue;
+            }
+            endRepeat();
+            pixel = pixels[i];
+            repeats = 1;
+        }
+    }
+
+    // Sends whatever is still held - call once after the last pixel
+    void finish() {
+        endRepeat();
+        flushLiterals();
+    }
+
+    // Bytes emitted so far
+    uint32_t size() const { return total; }
+
+private:
+    void endRepeat() {
+        if (repeats >= 2) {
+            flushLiterals();
+            uint8_t run[3] = {(uint8_t)(repeats - 1), (uint8_t)(pixel & 0xFF), (uint8_t)(pixel >> 8)};
+            send(run, sizeof(run));
+        } else if (repeats == 1) {
+            if (literals == 128) flushLiterals();
+            literal[1 + literals * 2] = pixel & 0xFF;
+            literal[2 + literals * 2] = pixel >> 8;
+            literals++;
+        }
+        repeats = 0;
+    }
+
+    void flushLiterals() {
+        if (literals == 0) return;
+        literal[0] = 0x80 | (literals - 1);
+        send(literal, 1 + literals * 2);
+        literals = 0;
+    }
+
+    void send(const uint8_t* bytes, size_t count) {
+        emit(bytes, count);
+        total += count;
+    }
+
+    Emit emit;
+    uint16_t pixel;         // Repeating now...
+    uint16_t repeats;       // ...this many times so far
+    uint16_t literals;      // Pixels waiting in literal
+    uint32_t total;
+    uint8_t literal[1 + 128 * 2];
+};
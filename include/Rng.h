@@ -0,0 +1,72 @@
+// Rng.h - Small, fast, reproducible random number streams
+//
+// xoshiro128** (Blackman & Vigna): 16 bytes of state, a handful of 32-bit
+// shifts, rotates and xors per number, and no division. Each subsystem owns
+// its own stream, so drawing more confetti no longer changes which
+// questions come up. Streams are seeded from one 32-bit seed plus the
+// stream's number through SplitMix64, so a logged seed replays everything.
+//
+// below(n) uses Lemire's multiply-and-shift, which has no modulo bias and
+// only divides in the rare case a draw has to be rejected.
+
+#pragma once
+
+#include <stdint.h>
+
+class Rng {
+public:
+    Rng() { seed(0, 0); }
+
+    // Same (seed, stream) always gives the same sequence; different streams
+    // from one seed are unrelated
+    void seed(uint32_t seed, uint32_t stream) {
+        uint64_t mix = ((uint64_t)stream << 32) | seed;
+        for (int i = 0; i < 4; i++) {
+            uint64_t z = (mix += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            s[i] = (uint32_t)((z ^ (z >> 31)) >> 32);
+        }
+        // All-zero state would stick at zero
+        if ((s[0] | s[1] | s[2] | s[3]) == 0) s[0] = 1;
+    }
+
+    uint32_t next() {
+        uint32_t result = rotl(s[1] * 5, 7) * 9;
+        uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+
+    // 0..n-1, every value equally likely. n must be at least 1.
+    uint32_t below(uint32_t n) {
+        uint64_t m = (uint64_t)next() * n;
+        uint32_t low = (uint32_t)m;
+        if (low < n) {
+            uint32_t threshold = (0u - n) % n;
+            while (low < threshold) {
+                m = (uint64_t)next() * n;
+                low = (uint32_t)m;
+            }
+        }
+        return (uint32_t)(m >> 32);
+    }
+
+    // lo..hi-1, like Arduino's random(lo, hi)
+    int32_t range(int32_t lo, int32_t hi) {
+        if (hi <= lo) return lo;
+        return lo + (int32_t)below((uint32_t)(hi - lo));
+    }
+
+private:
+    static uint32_t rotl(uint32_t x, int k) {
+        return (x << k) | (x >> (32 - k));
+    }
+
+    uint32_t s[4];
+};
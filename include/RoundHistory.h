@@ -0,0 +1,112 @@
+// RoundHistory.h - The last few rounds, for showing a trend
+//
+// A fixed ring of round results (mode, score, average answer time) that
+// lives in one packed blob, so it is saved and loaded in a single NVS call
+// and appending never moves the older entries.
+//
+// RoundSparkline keeps each round's plotted height next to it. A round's
+// height is worked out once, when it is appended; drawing the chart only
+// reads the cached heights, so the round-end screen can re-stroke it over
+// confetti every frame.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#define ROUND_HISTORY_LEN 16
+#define ROUND_HISTORY_VERSION 1
+
+struct __attribute__((packed)) RoundRecord {
+    uint8_t mode;               // RoundMode
+    uint8_t questions;          // Answered
+    uint8_t correct;
+    uint8_t reserved;
+    uint16_t avgMs;             // Average answer time, right or wrong
+
+    uint8_t percent() const {
+        return questions ? correct * 100 / questions : 0;
+    }
+};
+
+struct __attribute__((packed)) RoundHistoryBlob {
+    uint8_t version;
+    uint8_t head;               // Slot the next round goes in
+    uint8_t count;
+    uint8_t reserved;
+    RoundRecord rounds[ROUND_HISTORY_LEN];
+};
+static_assert(sizeof(RoundHistoryBlob) == 100, "RoundHistoryBlob layout changed - update the NVS budget");
+
+class RoundHistory {
+public:
+    RoundHistory() { clear(); }
+
+    void clear() {
+        memset(&blob, 0, sizeof(blob));
+        blob.version = ROUND_HISTORY_VERSION;
+    }
+
+    void append(const RoundRecord& round) {
+        blob.rounds[blob.head] = round;
+        blob.head = (blob.head + 1) % ROUND_HISTORY_LEN;
+        if (blob.count < ROUND_HISTORY_LEN) blob.count++;
+    }
+
+    uint8_t size() const { return blob.count; }
+
+    // 0 is the oldest round kept, size() - 1 the newest
+    const RoundRecord& at(uint8_t i) const { return blob.rounds[slot(i)]; }
+    uint8_t slot(uint8_t i) const {
+        return (blob.head + ROUND_HISTORY_LEN - blob.count + i) % ROUND_HISTORY_LEN;
+    }
+
+    // Saving and loading. After reading into data(), call loaded() - it
+    // starts over if the blob isn't one it understands.
+    RoundHistoryBlob* data() { return &blob; }
+    static constexpr size_t dataSize() { return sizeof(RoundHistoryBlob); }
+
+    void loaded() {
+        if (blob.version != ROUND_HISTORY_VERSION || blob.head >= ROUND_HISTORY_LEN ||
+            blob.count > ROUND_HISTORY_LEN) {
+            clear();
+        }
+    }
+
+private:
+    RoundHistoryBlob blob;
+};
+
+// Score percentages scaled to a chart `height` pixels tall, held in the same
+// slots as the history's rounds. y(i) is pixels down from the chart's top.
+class RoundSparkline {
+public:
+    explicit RoundSparkline(uint8_t height) : height(height) {
+        memset(heights, 0, sizeof(heights));
+    }
+
+    // Every point, after the history was loaded
+    void rebuild(const RoundHistory& history) {
+        for (uint8_t i = 0; i < history.size(); i++) {
+            heights[history.slot(i)] = scale(history.at(i));
+        }
+    }
+
+    // Just the newest point, after history.append()
+    void appended(const RoundHistory& history) {
+        uint8_t newest = history.size() - 1;
+        heights[history.slot(newest)] = scale(history.at(newest));
+    }
+
+    uint8_t y(const RoundHistory& history, uint8_t i) const {
+        return heights[history.slot(i)];
+    }
+
+private:
+    uint8_t scale(const RoundRecord& round) const {
+        return (uint8_t)((100 - round.percent()) * (height - 1) / 100);
+    }
+
+    uint8_t height;
+    uint8_t heights[ROUND_HISTORY_LEN];
+};
@@ -0,0 +1,548 @@
+// ScreenAssets.h - Pre-rendered static screen layers
+//
+// GENERATED by tools/make_assets.py - do not edit. Re-run the script after
+// changing a layer or a COLOR_* define.
+//
+//   layer                 raw bytes   rle bytes
+//   assetSplash              153600        2079
+//   assetMenu                153600        2028
+//   assetAchievement         153600        1950
+//   assetRoundEnd            153600        2217
+
+#pragma once
+
+#include "RleImage.h"
+
+static const uint8_t assetSplashData[2079] = {
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x29, 0x10, 0x82, 0x80, 0xFF, 0xE0, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x3D, 0x10, 0x82, 0x02, 0xFF, 0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x3D, 0x10, 0x82, 0x80, 0xFF, 0xE0, 0x0E, 0x10, 0x82, 0x80, 0xFF, 0xE0, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x3D, 0x10, 0x82, 0x02, 0xFF, 0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3D,
+    0x10, 0x82, 0x80, 0xFF, 0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x5B, 0x10, 0x82, 0x02, 0x07, 0xFF, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3B,
+    0x10, 0x82, 0x04, 0x07, 0xFF, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3A, 0x10, 0x82, 0x04, 0x07,
+    0xFF, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3A, 0x10, 0x82, 0x04, 0x07, 0xFF, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x3B, 0x10, 0x82, 0x02, 0x07, 0xFF, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x21, 0x10, 0x82, 0x80, 0x00, 0x1F, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x3D, 0x10, 0x82, 0x02, 0x00, 0x1F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x3D, 0x10, 0x82, 0x80, 0x00, 0x1F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x49, 0x10, 0x82, 0x02, 0x07,
+    0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3B, 0x10, 0x82, 0x04, 0x07, 0xE0, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x3A, 0x10, 0x82, 0x04, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3A,
+    0x10, 0x82, 0x04, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3B, 0x10, 0x82, 0x02, 0x07,
+    0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x66, 0x10, 0x82, 0x02, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3B, 0x10, 0x82,
+    0x04, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3A, 0x10, 0x82, 0x04, 0x07, 0xE0, 0x7F,
+    0x10, 0x82, 0x2C, 0x10, 0x82, 0x02, 0x78, 0x0F, 0x7F, 0x10, 0x82, 0x0A, 0x10, 0x82, 0x04, 0x07,
+    0xE0, 0x7F, 0x10, 0x82, 0x2B, 0x10, 0x82, 0x04, 0x78, 0x0F, 0x7F, 0x10, 0x82, 0x0A, 0x10, 0x82,
+    0x02, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x2C, 0x10, 0x82, 0x04, 0x78, 0x0F, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x3A, 0x10, 0x82, 0x04, 0x78, 0x0F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3B, 0x10,
+    0x82, 0x02, 0x78, 0x0F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x80, 0x10, 0x82, 0x02, 0xF8, 0x1F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x3B, 0x10, 0x82, 0x04, 0xF8, 0x1F, 0x3C, 0x10, 0x82, 0x02, 0xF8, 0x1F, 0x7F, 0x10, 0x82, 0x7A,
+    0x10, 0x82, 0x04, 0xF8, 0x1F, 0x3B, 0x10, 0x82, 0x04, 0xF8, 0x1F, 0x7F, 0x10, 0x82, 0x79, 0x10,
+    0x82, 0x04, 0xF8, 0x1F, 0x3B, 0x10, 0x82, 0x04, 0xF8, 0x1F, 0x7F, 0x10, 0x82, 0x7A, 0x10, 0x82,
+    0x02, 0xF8, 0x1F, 0x3C, 0x10, 0x82, 0x04, 0xF8, 0x1F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3B,
+    0x10, 0x82, 0x02, 0xF8, 0x1F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x76, 0x10, 0x82, 0x80, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3D, 0x10, 0x82, 0x02,
+    0x07, 0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3D, 0x10, 0x82, 0x80, 0x07, 0xE0, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x2E, 0x10, 0x82, 0x02, 0xFF, 0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x3B, 0x10, 0x82, 0x04, 0xFF, 0xE0, 0x7F, 0x10, 0x82, 0x71, 0x10, 0x82, 0x80, 0xF8, 0x00, 0x47,
+    0x10, 0x82, 0x04, 0xFF, 0xE0, 0x7F, 0x10, 0x82, 0x70, 0x10, 0x82, 0x02, 0xF8, 0x00, 0x46, 0x10,
+    0x82, 0x04, 0xFF, 0xE0, 0x7F, 0x10, 0x82, 0x71, 0x10, 0x82, 0x80, 0xF8, 0x00, 0x48, 0x10, 0x82,
+    0x02, 0xFF, 0xE0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x58, 0x10,
+    0x82, 0x02, 0x07, 0xFF, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3B, 0x10, 0x82, 0x04, 0x07, 0xFF,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3A, 0x10, 0x82, 0x04, 0x07, 0xFF, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x3A, 0x10, 0x82, 0x04, 0x07, 0xFF, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3B, 0x10,
+    0x82, 0x02, 0x07, 0xFF, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x77, 0x10, 0x82, 0x02, 0x00,
+    0x1F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3B, 0x10, 0x82, 0x04, 0x00, 0x1F, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x3A, 0x10, 0x82, 0x04, 0x00, 0x1F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3A,
+    0x10, 0x82, 0x04, 0x00, 0x1F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3B, 0x10, 0x82, 0x02, 0x00,
+    0x1F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x47, 0x10, 0x82,
+    0x80, 0x78, 0x0F, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x3D, 0x10, 0x82, 0x02, 0x78, 0x0F, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x3D, 0x10, 0x82, 0x80, 0x78, 0x0F, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x0B, 0x10, 0x82,
+};
+static const RleImage assetSplash = {320, 240, 2079, assetSplashData};
+
+static const uint8_t assetMenuData[2028] = {
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x47, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x2F, 0x07,
+    0xE0, 0x7F, 0x10, 0x82, 0x0C, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x35, 0x07, 0xE0, 0x7F, 0x10, 0x82,
+    0x07, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x39, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x04, 0x10, 0x82, 0x7F,
+    0x07, 0xE0, 0x3B, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x02, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x3D, 0x07,
+    0xE0, 0x7F, 0x10, 0x82, 0x80, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x3F, 0x07, 0xE0, 0x7E, 0x10, 0x82,
+    0x7F, 0x07, 0xE0, 0x41, 0x07, 0xE0, 0x7C, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x43, 0x07, 0xE0, 0x7B,
+    0x10, 0x82, 0x7F, 0x07, 0xE0, 0x43, 0x07, 0xE0, 0x7A, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x45, 0x07,
+    0xE0, 0x79, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x45, 0x07, 0xE0, 0x79, 0x10, 0x82, 0x7F, 0x07, 0xE0,
+    0x45, 0x07, 0xE0, 0x78, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F,
+    0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10,
+    0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0,
+    0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47,
+    0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07,
+    0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82,
+    0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77,
+    0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07,
+    0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0,
+    0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F,
+    0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10,
+    0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0,
+    0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47,
+    0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07,
+    0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82,
+    0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77,
+    0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07,
+    0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0,
+    0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F,
+    0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10,
+    0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0,
+    0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47,
+    0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07,
+    0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82,
+    0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77,
+    0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07,
+    0xE0, 0x78, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x45, 0x07, 0xE0, 0x79, 0x10, 0x82, 0x7F, 0x07, 0xE0,
+    0x45, 0x07, 0xE0, 0x79, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x45, 0x07, 0xE0, 0x7A, 0x10, 0x82, 0x7F,
+    0x07, 0xE0, 0x43, 0x07, 0xE0, 0x7B, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x43, 0x07, 0xE0, 0x7C, 0x10,
+    0x82, 0x7F, 0x07, 0xE0, 0x41, 0x07, 0xE0, 0x7E, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x3F, 0x07, 0xE0,
+    0x7F, 0x10, 0x82, 0x80, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x3D, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x02,
+    0x10, 0x82, 0x7F, 0x07, 0xE0, 0x3B, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x04, 0x10, 0x82, 0x7F, 0x07,
+    0xE0, 0x39, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x07, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x35, 0x07, 0xE0,
+    0x7F, 0x10, 0x82, 0x0C, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x2F, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x0A, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x39, 0x07, 0xFF, 0x7F, 0x10,
+    0x82, 0x03, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x3D, 0x07, 0xFF, 0x7F, 0x10, 0x82, 0x80, 0x10, 0x82,
+    0x7F, 0x07, 0xFF, 0x3F, 0x07, 0xFF, 0x7E, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x41, 0x07, 0xFF, 0x7C,
+    0x10, 0x82, 0x7F, 0x07, 0xFF, 0x43, 0x07, 0xFF, 0x7A, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x45, 0x07,
+    0xFF, 0x79, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x45, 0x07, 0xFF, 0x78, 0x10, 0x82, 0x7F, 0x07, 0xFF,
+    0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F,
+    0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10,
+    0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF,
+    0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47,
+    0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07,
+    0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82,
+    0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77,
+    0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07,
+    0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF,
+    0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F,
+    0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10,
+    0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF,
+    0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47,
+    0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07,
+    0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82,
+    0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77,
+    0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07,
+    0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF,
+    0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F,
+    0x07, 0xFF, 0x47, 0x07, 0xFF, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x47, 0x07, 0xFF, 0x78, 0x10,
+    0x82, 0x7F, 0x07, 0xFF, 0x45, 0x07, 0xFF, 0x79, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x45, 0x07, 0xFF,
+    0x7A, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x43, 0x07, 0xFF, 0x7C, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x41,
+    0x07, 0xFF, 0x7E, 0x10, 0x82, 0x7F, 0x07, 0xFF, 0x3F, 0x07, 0xFF, 0x7F, 0x10, 0x82, 0x80, 0x10,
+    0x82, 0x7F, 0x07, 0xFF, 0x3D, 0x07, 0xFF, 0x7F, 0x10, 0x82, 0x03, 0x10, 0x82, 0x7F, 0x07, 0xFF,
+    0x39, 0x07, 0xFF, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x42, 0x10, 0x82,
+};
+static const RleImage assetMenu = {320, 240, 2028, assetMenuData};
+
+static const uint8_t assetAchievementData[1950] = {
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x07, 0x10, 0x82, 0x2F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x0C, 0x10, 0x82, 0x35, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x07, 0x10,
+    0x82, 0x39, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x03, 0x10, 0x82, 0x3D, 0xFE, 0xA0,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x80, 0x10, 0x82, 0x3F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x7E,
+    0x10, 0x82, 0x41, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x7C, 0x10, 0x82, 0x43, 0xFE, 0xA0, 0x7F, 0x10,
+    0x82, 0x7A, 0x10, 0x82, 0x45, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x78, 0x10, 0x82, 0x47, 0xFE, 0xA0,
+    0x7F, 0x10, 0x82, 0x76, 0x10, 0x82, 0x49, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x75, 0x10, 0x82, 0x49,
+    0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x74, 0x10, 0x82, 0x4B, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x73, 0x10,
+    0x82, 0x4B, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x72, 0x10, 0x82, 0x4D, 0xFE, 0xA0, 0x7F, 0x10, 0x82,
+    0x71, 0x10, 0x82, 0x4D, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x71, 0x10, 0x82, 0x4D, 0xFE, 0xA0, 0x7F,
+    0x10, 0x82, 0x70, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE,
+    0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82,
+    0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F,
+    0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10,
+    0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0,
+    0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F,
+    0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10,
+    0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82,
+    0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F,
+    0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE,
+    0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82,
+    0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F,
+    0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10,
+    0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0,
+    0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F,
+    0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10,
+    0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82,
+    0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F,
+    0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE,
+    0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82,
+    0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F,
+    0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10,
+    0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0,
+    0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F,
+    0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10,
+    0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82,
+    0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x6F, 0x10, 0x82, 0x4F, 0xFE, 0xA0, 0x7F,
+    0x10, 0x82, 0x70, 0x10, 0x82, 0x4D, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x71, 0x10, 0x82, 0x4D, 0xFE,
+    0xA0, 0x7F, 0x10, 0x82, 0x71, 0x10, 0x82, 0x4D, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x72, 0x10, 0x82,
+    0x4B, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x73, 0x10, 0x82, 0x4B, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x74,
+    0x10, 0x82, 0x49, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x75, 0x10, 0x82, 0x49, 0xFE, 0xA0, 0x7F, 0x10,
+    0x82, 0x76, 0x10, 0x82, 0x47, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x78, 0x10, 0x82, 0x45, 0xFE, 0xA0,
+    0x7F, 0x10, 0x82, 0x7A, 0x10, 0x82, 0x43, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x7C, 0x10, 0x82, 0x41,
+    0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x7E, 0x10, 0x82, 0x3F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x80, 0x10, 0x82, 0x3D, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x03, 0x10, 0x82,
+    0x39, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x07, 0x10, 0x82, 0x35, 0xFE, 0xA0, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x0C, 0x10, 0x82, 0x2F, 0xFE, 0xA0, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x07, 0x10, 0x82,
+};
+static const RleImage assetAchievement = {320, 240, 1950, assetAchievementData};
+
+static const uint8_t assetRoundEndData[2217] = {
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x1F,
+    0x10, 0x82, 0x7F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x3C, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x05, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x37, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x09, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x33, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x0D, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x30, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x0F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x2E, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x11, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x2C, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x13, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x2A, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x15, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x28, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x17, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x26, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x19, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x25, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x19, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x24, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1B, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x23, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1B, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x22, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1D, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x21, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1D, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x21, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1D, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x20, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x1F, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x20, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1D, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x21, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1D, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x21, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1D, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x22, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x1B, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x23, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x1B, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x24, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x19, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x25, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x19, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x26, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x17, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x28, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x15, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x2A, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x13, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x2C, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x11, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x2E, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x0F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x30, 0x10, 0x82, 0x7F,
+    0x21, 0x04, 0x0D, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x33, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x09, 0x21,
+    0x04, 0x7F, 0x10, 0x82, 0x37, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x05, 0x21, 0x04, 0x7F, 0x10, 0x82,
+    0x3C, 0x10, 0x82, 0x7F, 0x21, 0x04, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x22, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x39, 0x07, 0xE0, 0x7F, 0x10,
+    0x82, 0x03, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x3D, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x80, 0x10, 0x82,
+    0x7F, 0x07, 0xE0, 0x3F, 0x07, 0xE0, 0x7E, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x41, 0x07, 0xE0, 0x7C,
+    0x10, 0x82, 0x7F, 0x07, 0xE0, 0x43, 0x07, 0xE0, 0x7A, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x45, 0x07,
+    0xE0, 0x79, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x45, 0x07, 0xE0, 0x78, 0x10, 0x82, 0x7F, 0x07, 0xE0,
+    0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F,
+    0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10,
+    0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0,
+    0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47,
+    0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07,
+    0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82,
+    0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77,
+    0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07,
+    0xE0, 0x77, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x47, 0x07, 0xE0, 0x78, 0x10, 0x82, 0x7F, 0x07, 0xE0,
+    0x45, 0x07, 0xE0, 0x79, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x45, 0x07, 0xE0, 0x7A, 0x10, 0x82, 0x7F,
+    0x07, 0xE0, 0x43, 0x07, 0xE0, 0x7C, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x41, 0x07, 0xE0, 0x7E, 0x10,
+    0x82, 0x7F, 0x07, 0xE0, 0x3F, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x80, 0x10, 0x82, 0x7F, 0x07, 0xE0,
+    0x3D, 0x07, 0xE0, 0x7F, 0x10, 0x82, 0x03, 0x10, 0x82, 0x7F, 0x07, 0xE0, 0x39, 0x07, 0xE0, 0x7F,
+    0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10,
+    0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82,
+    0x7F, 0x10, 0x82, 0x7F, 0x10, 0x82, 0x02, 0x10, 0x82,
+};
+static const RleImage assetRoundEnd = {320, 240, 2217, assetRoundEndData};
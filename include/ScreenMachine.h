@@ -0,0 +1,115 @@
+// ScreenMachine.h - Table-driven screen state machine
+//
+// Each screen is a state with enter/exit/update/draw/touch/gesture hooks. Screen flow
+// lives in a transition table keyed by (state, event), flattened at startup
+// into a dense lookup so fire() is a single array read. Missing hooks are
+// replaced with no-ops, so per-frame dispatch is always one indirect call.
+//
+// New screens or game modes plug in with addState() + addTransitions();
+// loop() only ever calls update(), gesture() and touch().
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "GestureRecognizer.h"
+
+struct ScreenState {
+    void (*enter)();                    // State setup (runs before draw)
+    void (*exit)();                     // State teardown
+    void (*update)(unsigned long now);  // Once per frame
+    void (*draw)();                     // Full repaint of the screen
+    void (*touch)(int x, int y);        // Tap at a point
+    bool (*gesture)(const Gesture& g);  // Any gesture - false leaves all but swipes to touch()
+};
+
+struct ScreenTransition {
+    uint8_t from;
+    uint8_t event;
+    uint8_t to;
+};
+
+template <uint8_t NumStates, uint8_t NumEvents>
+class ScreenMachine {
+public:
+    static const uint8_t NO_TRANSITION = 0xFF;
+
+    ScreenMachine() : currentId(0), current(&states[0]) {
+        memset(next, NO_TRANSITION, sizeof(next));
+        for (uint8_t i = 0; i < NumStates; i++) {
+            states[i] = ScreenState{noop, noop, noopUpdate, noop, noopTouch, noopGesture};
+        }
+    }
+
+    void addState(uint8_t id, const ScreenState &state) {
+        if (id >= NumStates) return;
+        states[id].enter = state.enter ? state.enter : noop;
+        states[id].exit = state.exit ? state.exit : noop;
+        states[id].update = state.update ? state.update : noopUpdate;
+        states[id].draw = state.draw ? state.draw : noop;
+        states[id].touch = state.touch ? state.touch : noopTouch;
+        states[id].gesture = state.gesture ? state.gesture : noopGesture;
+    }
+
+    void addTransitions(const ScreenTransition *table, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            if (table[i].from < NumStates && table[i].event < NumEvents) {
+                next[table[i].from][table[i].event] = table[i].to;
+            }
+        }
+    }
+
+    // Enter the initial state (no exit hook runs)
+    void start(uint8_t id) {
+        currentId = id;
+        current = &states[id];
+        current->enter();
+        current->draw();
+    }
+
+    // Returns false if the current state has no transition for this event
+    bool fire(uint8_t event) {
+        if (event >= NumEvents) return false;
+        uint8_t to = next[currentId][event];
+        if (to == NO_TRANSITION) return false;
+
+        current->exit();
+        currentId = to;
+        current = &states[to];
+        current->enter();
+        current->draw();
+        return true;
+    }
+
+    // Unconditional jump for targets not known until runtime, such as the
+    // entry screen of a registered minigame
+    void go(uint8_t id) {
+        if (id >= NumStates) return;
+
+        current->exit();
+        currentId = id;
+        current = &states[id];
+        current->enter();
+        current->draw();
+    }
+
+    void update(unsigned long now) { current->update(now); }
+    void touch(int x, int y) { current->touch(x, y); }
+    bool gesture(const Gesture& g) { return current->gesture(g); }
+    void redraw() { current->draw(); }
+
+    uint8_t state() const { return currentId; }
+
+private:
+    static void noop() {}
+    static void noopUpdate(unsigned long) {}
+    static void noopTouch(int, int) {}
+    static bool noopGesture(const Gesture&) { return false; }
+
+    ScreenState states[NumStates];
+    uint8_t next[NumStates][NumEvents];
+    uint8_t currentId;
+    const ScreenState *current;
+};
@@ -0,0 +1,183 @@
+// SmoothFont.h - Anti-aliased VLW fonts with a pre-blended glyph cache
+//
+// A VLW font stores an 8-bit coverage bitmap per glyph. TFT_eSPI blends
+// that against the screen one pixel at a time, reading GRAM back when it
+// doesn't know the background. Here every widget that shows smooth text sits
+// on a flat color it already knows (a box, a button, the screen
+// background), so each glyph is blended once per (font, glyph, color,
+// background) into RGB565 and kept in the GlyphCache. Drawing a cached
+// glyph is then one windowed pixel push - no read-back and no per-pixel
+// maths on the hot path.
+//
+// Fixed size, no allocation. Glyph pixels are stored byte-swapped, ready
+// for pushPixels().
+
+#pragma once
+
+#include <stdint.h>
+
+#include "Color565.h"
+
+#define SMOOTH_FONT_GLYPHS 48      // Per font - the generator keeps fonts small
+#define GLYPH_CACHE_ENTRIES 96     // Blended glyphs held at once
+#define GLYPH_CACHE_PIXELS 16384   // Pool shared by all entries (32 KB)
+
+class SmoothFont {
+public:
+    struct Glyph {
+        uint16_t code;
+        uint8_t width, height;
+        uint8_t advance;
+        int8_t top;             // Baseline to the bitmap's first row
+        int8_t left;            // Pen position to the bitmap's first column
+        uint32_t offset;        // Into the coverage bitmaps
+    };
+
+    SmoothFont() : ascent(0), descent(0), numGlyphs(0), bitmaps(nullptr) {}
+
+    // Indexes a VLW font held in flash. False if it doesn't look like one
+    // or has more glyphs than SMOOTH_FONT_GLYPHS.
+    bool begin(const uint8_t* vlw, uint32_t length) {
+        numGlyphs = 0;
+        if (length < 24) return false;
+        uint32_t count = read32(vlw);
+        if (count > SMOOTH_FONT_GLYPHS || 24 + count * 28 > length) return false;
+        ascent = read32(vlw + 16);
+        descent = read32(vlw + 20);
+
+        const uint8_t* metrics = vlw + 24;
+        uint32_t offset = 0;
+        for (uint32_t i = 0; i < count; i++, metrics += 28) {
+            Glyph& g = glyphs[i];
+            g.code = read32(metrics);
+            g.height = read32(metrics + 4);
+            g.width = read32(metrics + 8);
+            g.advance = read32(metrics + 12);
+            g.top = (int32_t)read32(metrics + 16);
+            g.left = (int32_t)read32(metrics + 20);
+            g.offset = offset;
+            offset += g.width * g.height;
+        }
+        bitmaps = vlw + 24 + count * 28;
+        if (24 + count * 28 + offset > length) return false;
+        numGlyphs = count;
+        return true;
+    }
+
+    const Glyph* glyph(uint16_t code) const {
+        for (uint8_t i = 0; i < numGlyphs; i++) {
+            if (glyphs[i].code == code) return &glyphs[i];
+        }
+        return nullptr;
+    }
+
+    const uint8_t* coverage(const Glyph& g) const { return bitmaps + g.offset; }
+
+    // Characters the font lacks take half the ascent, as a gap
+    int advanceOf(uint16_t code) const {
+        const Glyph* g = glyph(code);
+        return g ? g->advance : ascent / 2;
+    }
+
+    int textWidth(const char* text) const {
+        int width = 0;
+        while (*text) width += advanceOf((uint8_t)*text++);
+        return width;
+    }
+
+    int ascent;                 // Tallest glyph above the baseline
+    int descent;                // Deepest glyph below it
+
+private:
+    static uint32_t read32(const uint8_t* p) {
+        return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+
+    Glyph glyphs[SMOOTH_FONT_GLYPHS];
+    uint8_t numGlyphs;
+    const uint8_t* bitmaps;
+};
+
+struct GlyphCacheCounters {
+    uint32_t hits;
+    uint32_t misses;            // Glyphs blended
+    uint32_t flushes;           // Times the cache filled up and started over
+};
+
+class GlyphCache {
+public:
+    GlyphCache() : count(0), used(0), counters{} {}
+
+    // Blended pixels for a glyph in this color on this background, or
+    // nullptr for an empty glyph (a space). When the entries or the pool run
+    // out the whole cache starts over: screens show few color pairs, so the
+    // next screen's glyphs simply replace the last one's.
+    const uint16_t* get(const SmoothFont& font, const SmoothFont::Glyph& g, uint16_t color, uint16_t bg) {
+        uint32_t pixels = (uint32_t)g.width * g.height;
+        if (pixels == 0 || pixels > GLYPH_CACHE_PIXELS) return nullptr;
+
+        for (uint16_t i = 0; i < count; i++) {
+            const Entry& e = entries[i];
+            if (e.font == &font && e.code == g.code && e.color == color && e.bg == bg) {
+                counters.hits++;
+                return pool + e.offset;
+            }
+        }
+
+        if (count == GLYPH_CACHE_ENTRIES || used + pixels > GLYPH_CACHE_PIXELS) {
+            clear();
+            counters.flushes++;
+        }
+        counters.misses++;
+
+        Entry& e = entries[count++];
+        e.font = &font;
+        e.code = g.code;
+        e.color = color;
+        e.bg = bg;
+        e.offset = used;
+        used += pixels;
+
+        uint16_t* out = pool + e.offset;
+        const uint8_t* alpha = font.coverage(g);
+        for (uint32_t i = 0; i < pixels; i++) {
+            uint16_t c = color565Blend(color, bg, alpha[i]);
+            out[i] = (uint16_t)((c >> 8) | (c << 8));
+        }
+        return out;
+    }
+
+    void clear() {
+        count = 0;
+        used = 0;
+    }
+
+    // True if get() for a glyph this size could start the cache over
+    bool mayFlush(uint32_t pixels) const {
+        return count == GLYPH_CACHE_ENTRIES || used + pixels > GLYPH_CACHE_PIXELS;
+    }
+
+    GlyphCacheCounters takeCounters() {
+        GlyphCacheCounters taken = counters;
+        counters = GlyphCacheCounters{};
+        return taken;
+    }
+
+    uint16_t entriesUsed() const { return count; }
+    uint32_t pixelsUsed() const { return used; }
+
+private:
+    struct Entry {
+        const SmoothFont* font;
+        uint16_t code;
+        uint16_t color;
+        uint16_t bg;
+        uint32_t offset;        // Into pool
+    };
+
+    Entry entries[GLYPH_CACHE_ENTRIES];
+    uint16_t count;
+    uint32_t used;
+    GlyphCacheCounters counters;
+    uint16_t pool[GLYPH_CACHE_PIXELS];
+};
@@ -0,0 +1,1300 @@
+// SmoothFonts.h - Anti-aliased VLW fonts for the question, answers and titles
+//
+// GENERATED by tools/make_fonts.py - do not edit. Re-run the script after
+// changing a size or the characters a widget shows.
+//
+// Source: SourceCodePro-Bold.ttf
+//
+//   font           px  ascent descent   bytes  characters
+//   fontQuestion   36      26       6    6924  "0123456789 +-x/=?"
+//   fontAnswer     32      21       1    3993  "0123456789-"
+//   fontTitle      30      21       6    9478  " !ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+
+#pragma once
+
+#include <stdint.h>
+
+static const uint8_t fontQuestionVlw[6924] = {
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x16,
+    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1A,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x16,
+    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x16,
+    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x16,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x60, 0x60, 0x60, 0x48, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xC7, 0xFF, 0xFF, 0xFF, 0xEF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x0C, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x9F, 0x9F, 0x9F,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x0C, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x8F, 0x8F, 0x8F,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE1, 0xFF, 0xFF,
+    0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF,
+    0xFF, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF6,
+    0xFF, 0xFF, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
+    0xFF, 0xFF, 0xFF, 0xF6, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC7, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xE1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xE7, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFE, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0xF9, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xF2, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xFF, 0xFF, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xDB, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEB, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xFF, 0xFF, 0xFD, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0xB9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFB, 0xFF, 0xFF, 0xFF, 0x5A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0xEF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0x97, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFF, 0xFF, 0xFF, 0xD5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEF, 0xFF, 0xFF, 0xFF,
+    0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xFF, 0xFF,
+    0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFD, 0xFF,
+    0xFF, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF,
+    0xFF, 0xFF, 0xEB, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDA,
+    0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x33, 0x4A, 0x44, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xAD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x7F, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDD, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x1C, 0x00, 0x00, 0x00, 0x27, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
+    0xD4, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAC, 0x15, 0x00, 0x00, 0x3E, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0x00, 0x16, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xDB, 0x07, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x63, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xF5, 0x07,
+    0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x39, 0xC9, 0xFF, 0xFF, 0xFF, 0xED, 0x00, 0x00, 0x11, 0x4C, 0x3D, 0x02, 0x00, 0x53, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x63, 0xE6, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x3B, 0xF0, 0xFF, 0xFF, 0xBC, 0x07,
+    0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF5, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xC3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5C, 0x25, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x7E, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF4, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+    0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x26, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xE6, 0xFF, 0xFF, 0xFF,
+    0xD0, 0x00, 0x22, 0xD2, 0xFF, 0xFC, 0x8F, 0x01, 0x37, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xC8, 0xFF,
+    0xFF, 0xFF, 0xED, 0x00, 0x00, 0x01, 0x1C, 0x10, 0x00, 0x00, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0x63,
+    0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x38, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF,
+    0xFF, 0xFF, 0xF5, 0x06, 0x16, 0xFB, 0xFF, 0xFF, 0xFF, 0xD7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x44,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x07, 0x00, 0x00,
+    0x2B, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0x00, 0x00, 0x2B, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9,
+    0xB3, 0xC0, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x75, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x44, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x97, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x56, 0x6E, 0x68, 0x44, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x78, 0xD9, 0xDF, 0xDF, 0xDF, 0x1C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4D, 0x9C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80,
+    0x80, 0x80, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x50, 0x50, 0x50, 0x50, 0x66, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x66, 0x50, 0x50, 0x50, 0x50, 0x19, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x34, 0x48, 0x48, 0x31, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5E, 0xC2, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xAE,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x8A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x09, 0xE0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEB, 0xDF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3B, 0x00, 0x00, 0x00,
+    0x24, 0xE3, 0xFF, 0xFF, 0xBA, 0x34, 0x00, 0x00, 0x05, 0x5D, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0xE2, 0x78, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x42, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x42, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE,
+    0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xEC, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF5, 0x6F, 0x59, 0x6C, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x1C, 0x00, 0x5F, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x40, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x34,
+    0x49, 0x48, 0x36, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64,
+    0xC5, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x7B, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x54, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x47, 0x00, 0x00,
+    0x00, 0x00, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF9, 0x3C, 0x00, 0x00, 0x00, 0x2C, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xDF, 0xE8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x01, 0x00, 0x00, 0x00, 0x4E, 0xFD, 0xFF, 0xBC, 0x41, 0x03, 0x00,
+    0x00, 0x2A, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x55, 0xEB, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x91, 0xA2, 0xBD, 0xEF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x37, 0x4D, 0x75, 0xB3, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDB, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x56, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00,
+    0x84, 0xB6, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x11, 0x00, 0x42, 0xFD, 0xFF, 0xF2, 0x83, 0x26, 0x00, 0x00, 0x00, 0x1B, 0x82, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDB, 0x00, 0x15, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xDF, 0xE8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x34, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x02, 0x00, 0x00, 0x29, 0xCA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x99, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x56, 0xBD, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xA5, 0x37, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x3E, 0x5B, 0x6E, 0x6E, 0x5A, 0x34, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xDF, 0xDF, 0xDF,
+    0xDF, 0xDF, 0xDF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0xFF, 0xFF, 0xFF, 0xE9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xDD, 0xFF, 0xFF,
+    0xFF, 0xC6, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9C, 0xFF, 0xFF, 0xFF, 0xF8, 0x2C, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xE9, 0xFF, 0xFF, 0xFF, 0xD0, 0x05, 0x00, 0xB0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xF8, 0x2E,
+    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x75, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x03, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x80, 0x80, 0x08, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x10, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x60, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x80, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCE, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+    0x1C, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDE, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x14, 0x00, 0x00, 0x00,
+    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x78,
+    0x9C, 0x9F, 0x95, 0x6D, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x4C, 0x00, 0x00,
+    0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x59, 0xEA, 0xD5, 0x6A, 0x24, 0x10, 0x1D, 0x56, 0xD0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x15, 0x00, 0x00, 0x68, 0xBF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x28, 0xF5, 0xFF, 0xF5, 0x87, 0x21, 0x00, 0x00, 0x00, 0x30,
+    0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x06, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA,
+    0xDF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0x17, 0x00, 0x1D, 0xE0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x4A, 0x00, 0x00, 0x00, 0x14,
+    0xA6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x46, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0xA7, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x85, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x35, 0x59, 0x6C, 0x6F, 0x59, 0x2E,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2A,
+    0x47, 0x49, 0x36, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x9B,
+    0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xC7, 0x65, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7A,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x3E, 0x00, 0x00, 0x00, 0x01,
+    0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x18, 0x00,
+    0x00, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61,
+    0x00, 0x00, 0x1E, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x61, 0x17, 0x00, 0x19, 0x65, 0xDB, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x95, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x60, 0x01, 0x00, 0x00, 0x09, 0xF2, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0x67, 0x00,
+    0x00, 0x03, 0x2E, 0x4C, 0x3C, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x35, 0x0F, 0x83, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x55, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x54, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x03, 0x00, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A,
+    0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x90, 0x74, 0x94, 0xEB, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF3, 0x10, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x04, 0x00, 0x00, 0x00, 0x12, 0xD5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x07, 0xEB, 0xFF, 0xFF, 0xFF,
+    0xF9, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xCB, 0x14, 0x00, 0x00, 0x00, 0x3E, 0xF6, 0xFF, 0xFF, 0xFF, 0xFE, 0x26, 0x00,
+    0x0E, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x9F, 0x8A, 0xB7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x3A, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE2, 0x17, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xD8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x8E, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE7, 0x7F, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x3A, 0x62,
+    0x70, 0x5E, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+    0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x54, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x3C, 0x78, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xCA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xE3, 0xFF,
+    0xFF, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB4,
+    0xFF, 0xFF, 0xFF, 0xD4, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x65, 0xFF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0xF0, 0xFF, 0xFF, 0xFF, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xEF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2A, 0xFD, 0xFF, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF8, 0xFF, 0xFF, 0xFF, 0xBD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xF9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x34, 0x49,
+    0x47, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xC0, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xAE, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xB3, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x65, 0x00, 0x00, 0x00,
+    0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x9B, 0x66, 0x6D, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x07,
+    0x00, 0x00, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x44, 0x00, 0x00, 0xCC, 0xFF, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x6A, 0x00, 0x00, 0xCC, 0xFF, 0xFF, 0xFF, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x65, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x00, 0x00,
+    0x00, 0x00, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+    0x8C, 0x14, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF6, 0xA0, 0x8C, 0xFF, 0xFF, 0xFF, 0xD8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x99, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x27, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3C, 0xDD, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+    0x5E, 0x00, 0x00, 0x00, 0x4D, 0xF9, 0xFF, 0xFF, 0xFA, 0x56, 0x1E, 0x7E, 0xDD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x4B, 0x00, 0x1C, 0xF3, 0xFF, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x02, 0x54,
+    0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x04, 0x88, 0xFF, 0xFF, 0xFF, 0xEB, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xC2, 0xFF, 0xFF, 0xFF, 0xC6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0xCA, 0xFF, 0xFF, 0xFF, 0xE8,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0xA5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0x4E,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x69, 0x43, 0x46, 0x77, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1,
+    0x05, 0x01, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0x4C, 0x00, 0x00, 0x0A, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF3, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xC0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEC, 0x91, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x42, 0x60, 0x70,
+    0x6B, 0x56, 0x2E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x28, 0x45, 0x49, 0x2F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x91, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xA8, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x57, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x88, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x57, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xA0, 0x01, 0x00, 0x00, 0x00, 0x1A, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBD, 0xB1, 0xE2,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0x1C,
+    0x00, 0x00, 0x02, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0x10, 0x00, 0x00, 0xDE, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0x00, 0x0A, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xFE, 0xFF, 0xFF, 0xFF, 0xC9,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x0D, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0x00, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x9C, 0x5C, 0x55, 0x89, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x19, 0xF0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x60,
+    0x00, 0x00, 0x4A, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0x98, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x2C, 0xB6, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0x63, 0x01,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x50, 0x6C, 0x67, 0x36,
+    0x01, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0xFF, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x2E, 0x00, 0x00, 0x00, 0x0A, 0xC6, 0xF5, 0x80, 0x1A, 0x00, 0x00, 0x10, 0x73, 0xF5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x03, 0xB1, 0xFF, 0xFF, 0xFF, 0xFE, 0xE4, 0xE1, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x21, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x11, 0xA7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xB1, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x8C, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x44, 0x63, 0x70, 0x60, 0x38, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x68, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF,
+    0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0x0D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x0A, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x54, 0x7E, 0x8F, 0x82, 0x62, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+    0x97, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0x44, 0x00, 0x00, 0x00, 0x45, 0xEB, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x67, 0x00, 0x35, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x2F, 0x02, 0x92, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xC8, 0xC2, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x00, 0x00, 0x7E, 0xFF, 0x9C, 0x15, 0x00,
+    0x00, 0x0D, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x44, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xC7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xB6, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBB, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0x0D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF2, 0xFF, 0xFF, 0xFF, 0xEB, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2C, 0xCF, 0xCF, 0xCF, 0xCF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x66, 0xC0, 0xCF, 0xA5, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xEA, 0xFF, 0xFF, 0xFF, 0xB3,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x58, 0x6C, 0x3B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xCC, 0xDF, 0xDF, 0xDF, 0xDF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xC5, 0xDF, 0xDF, 0xDF, 0xDF, 0x87, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48,
+    0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x15, 0x00, 0x00, 0x00, 0xAD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x0B, 0x00, 0x00, 0x0E, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x26, 0x0C, 0xEC,
+    0xFF, 0xFF, 0xFF, 0xF6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xD0, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x35, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xEA, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xEA, 0xFF, 0xFF, 0xFF, 0xEF, 0x45, 0xFB, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x74, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE1, 0x09, 0x00, 0x08, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0x01, 0x00, 0x00,
+    0x00, 0x15, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x36, 0xFB, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x74, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x31, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x0A,
+};
+
+static const uint8_t fontAnswerVlw[3993] = {
+    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x16,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x30, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3C, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x18, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x6F, 0xA0, 0xAF,
+    0xA7, 0x7B, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0xA7, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x73, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x24, 0x00, 0x15, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0x00, 0x00, 0x6A, 0xFF, 0xFF,
+    0xFF, 0xEB, 0x10, 0x00, 0x00, 0x00, 0x01, 0xC5, 0xFF, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0xB6, 0xFF,
+    0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0xFF, 0xFF, 0xEA, 0x01, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x16,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x05, 0x79, 0xB8, 0x8F, 0x12, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0x49,
+    0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x81, 0xFF, 0xFF, 0xFF, 0xB6, 0x00, 0xD1, 0xFF, 0xFF, 0xFF,
+    0x5E, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC9, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0xCF, 0xFF, 0xFF,
+    0xFF, 0x64, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAB, 0xFF, 0xFF, 0xFF, 0xDE, 0x00, 0xCF, 0xFF,
+    0xFF, 0xFF, 0x60, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x28, 0xDC, 0xFF, 0xEE, 0x49, 0x00, 0xD8,
+    0xFF, 0xFF, 0xFF, 0x57, 0x07, 0xFD, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x02, 0x1D, 0x06, 0x00, 0x02,
+    0xF6, 0xFF, 0xFF, 0xFF, 0x39, 0x00, 0xD9, 0xFF, 0xFF, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0xFF, 0xFF, 0xFF, 0xFD, 0x0E, 0x00, 0x98, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xCB, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00,
+    0x00, 0x1D, 0xED, 0xFF, 0xFF, 0xFF, 0x73, 0x00, 0x00, 0x00, 0xCB, 0xFF, 0xFF, 0xFF, 0xF2, 0x7D,
+    0x45, 0x6A, 0xE1, 0xFF, 0xFF, 0xFF, 0xEE, 0x10, 0x00, 0x00, 0x00, 0x33, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xF8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+    0xBC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0x4F, 0x60, 0x56, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x4F, 0x50, 0x50, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x86, 0xEF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x9F,
+    0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x70,
+    0x70, 0x70, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xCF, 0xCF,
+    0xCF, 0xCF, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xCF, 0xCF, 0xCF, 0xCF, 0x27, 0x60, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x60, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x60, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x6F, 0x9D, 0xAF, 0xAD, 0x91, 0x55, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0xB0, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4B, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0x00, 0x00, 0x00,
+    0x24, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x39, 0x00,
+    0x00, 0x00, 0x69, 0xFE, 0xFF, 0xE4, 0x5D, 0x0D, 0x00, 0x23, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE,
+    0x00, 0x00, 0x00, 0x00, 0x69, 0xB8, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+    0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7,
+    0xFF, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+    0xFE, 0xFF, 0xFF, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xD8, 0xFF, 0xFF, 0xFF, 0xD5, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xB1, 0xFF, 0xFF, 0xFF, 0xFA, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
+    0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xCC, 0xE3, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x1E, 0x19,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+    0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x20, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x26, 0x6F, 0x9D, 0xAF, 0xAF, 0x97, 0x6B, 0x23, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x36, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xB2, 0x1E,
+    0x00, 0x00, 0x01, 0x8B, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9,
+    0x25, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC3, 0x00, 0x00, 0x04, 0xBC, 0xFF, 0xE2, 0x68, 0x17, 0x00, 0x0F, 0x64, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x27, 0x00, 0x00, 0x12, 0x87, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCF, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1D, 0x3A, 0x73, 0xDD, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x47,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x2A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA0,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x4E, 0x63, 0x8C, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xD2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0xFF, 0xE4, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x00, 0x36, 0xFA, 0xBA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFB, 0xFF, 0xFF,
+    0xFF, 0xE1, 0x0F, 0xDC, 0xFF, 0xFF, 0xFD, 0xBD, 0x80, 0x70, 0x7F, 0xBA, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x90, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE2, 0x15, 0x03, 0x86, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6,
+    0x24, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x6E, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x30, 0x51, 0x60, 0x5F, 0x47, 0x1A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x50, 0x50, 0x50, 0x50, 0x50,
+    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xEF, 0xFF, 0xFF, 0xF3,
+    0xFA, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBC, 0xFF, 0xFF, 0xFF,
+    0x72, 0xF9, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF,
+    0xC7, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xF7, 0xFF, 0xFF,
+    0xF8, 0x2B, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCD, 0xFF, 0xFF,
+    0xFF, 0x7C, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xFF,
+    0xFF, 0xC5, 0x03, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x3A, 0xFC, 0xFF,
+    0xFF, 0xF3, 0x24, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x0C, 0xDB, 0xFF,
+    0xFF, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x97, 0xFF,
+    0xFF, 0xFF, 0xEA, 0x70, 0x70, 0x70, 0x70, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x70, 0x62, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+    0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xDF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x1C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x66, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x0A, 0x00, 0x00, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xFF, 0xE1, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x14, 0x00, 0x00, 0x9B, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0xFF, 0xFF, 0x89, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0x73, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xC8, 0xDD, 0xFE,
+    0xFF, 0xE8, 0xB2, 0x59, 0x02, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0x1C, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x0A, 0x00, 0x00, 0x38, 0xD3, 0xFB, 0xA7, 0x5C, 0x45, 0x5B,
+    0xA3, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCD, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xDB, 0xFF, 0xFF, 0xFF, 0xEB, 0x00, 0x23, 0xF2, 0xC2, 0x2D, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x04, 0xC5, 0xFF, 0xFF, 0xFD, 0xB9, 0x7E, 0x70, 0x87,
+    0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x00, 0x00, 0x62, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x03, 0x00, 0x00, 0x00, 0x17, 0x88, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0xBD, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x27, 0x4C, 0x60, 0x5F,
+    0x44, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x68, 0x9D,
+    0xAF, 0xAB, 0x8F, 0x55, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x92, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0x7A, 0x07, 0x00, 0x00, 0x00, 0x00, 0x15, 0xD0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0x06, 0x00, 0x00, 0x07, 0xCB, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDC, 0x64, 0x27, 0x23, 0x54, 0xBF, 0xFF, 0x99, 0x00, 0x00, 0x00, 0x0D, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xCE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x03, 0x00, 0x00, 0x00, 0x62, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
+    0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDE, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x13, 0x6C, 0xA5, 0xAF, 0x97, 0x5C, 0x0B, 0x00, 0x00, 0x00,
+    0x02, 0xFC, 0xFF, 0xFF, 0xFF, 0x5B, 0x79, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x48, 0x00,
+    0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
+    0x3E, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xB0, 0xA4, 0xDA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xD2, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x0C, 0x00, 0x00, 0x02, 0x88, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x30, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xE3, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xF0, 0xFF, 0xFF, 0xFF, 0x62, 0x00, 0x23, 0xFD, 0xFF, 0xFF, 0xFF, 0x74, 0x00, 0x00,
+    0x00, 0x00, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFC, 0x87,
+    0x31, 0x2C, 0x77, 0xF5, 0xFF, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x13, 0xE0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x24, 0xDB, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+    0x86, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAD, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x37, 0x5B, 0x60, 0x45, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x14, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2D, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xA0, 0xF8, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFF, 0xFF, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFA, 0xFF, 0xFF, 0xD5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xFF, 0xFF, 0xFC, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0xF3, 0xFF, 0xFF, 0xF9, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xEE, 0xFF, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x58, 0xFF, 0xFF, 0xFF, 0xF2, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xED, 0xFF, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB8, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCB, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2B, 0x77, 0xA1, 0xAF, 0xAB, 0x8B, 0x4C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x42, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x91, 0xA6, 0xF3, 0xFF, 0xFF, 0xFF, 0xDB, 0x02,
+    0x00, 0x00, 0x09, 0xF8, 0xFF, 0xFF, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x25, 0xED, 0xFF, 0xFF, 0xFF,
+    0x39, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0xF7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0xFF,
+    0xFF, 0x5D, 0x00, 0x00, 0x25, 0xFF, 0xFF, 0xFF, 0xFB, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF,
+    0xFF, 0xFF, 0x54, 0x00, 0x00, 0x03, 0xE9, 0xFF, 0xFF, 0xFF, 0xA4, 0x08, 0x00, 0x00, 0x00, 0xC8,
+    0xFF, 0xFF, 0xF7, 0x15, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x69, 0x0D, 0x68,
+    0xFF, 0xFF, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00, 0x01, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+    0xFC, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC4, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x70, 0xF2, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x47, 0x00, 0x00, 0x00, 0x01, 0xA2, 0xFF, 0xFF, 0xFF, 0x77,
+    0x3C, 0x9B, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x3C, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0x94,
+    0x00, 0x00, 0x00, 0x0E, 0x83, 0xFC, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xDA, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0x25, 0x0A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x04, 0xFB, 0xFF,
+    0xFF, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0x00, 0xC2,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x64, 0x09, 0x00, 0x00, 0x3C, 0xDB, 0xFF, 0xFF, 0xFF, 0xEE, 0x08, 0x00,
+    0x45, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xE2, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0x00,
+    0x00, 0x00, 0x67, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x2F, 0xAA, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBA, 0x44, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x39, 0x58, 0x60, 0x5A, 0x3F, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x55, 0x91, 0xAE, 0xAD, 0x8E, 0x51, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6,
+    0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xD9, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0xCB, 0xFF, 0xFF, 0xFF, 0xE4, 0x37, 0x00, 0x00,
+    0x25, 0xD2, 0xFF, 0xFF, 0xFF, 0xEA, 0x0C, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0x1E, 0xF6, 0xFF, 0xFF, 0xFF, 0x6A, 0x00, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xFF, 0xFF, 0xFF, 0xBE, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFF, 0xFF, 0xFF, 0xF6, 0x03, 0x32, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x3A, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x06, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xDB, 0x3E, 0x02, 0x03, 0x3E, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x85, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x09,
+    0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x99, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x0B, 0x8B, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x3B, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x3F, 0x5D, 0x59, 0x24, 0x00, 0x00, 0x66, 0xFF, 0xFF, 0xFF, 0xF1,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF,
+    0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFD, 0xFF, 0xFF,
+    0xFF, 0x67, 0x00, 0x00, 0x00, 0x0B, 0x9E, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDE, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x0C, 0x00, 0x00, 0x04, 0xB6, 0xFF, 0xFC, 0xB3, 0x78, 0x74, 0xA6, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB4, 0x02, 0x00, 0x00, 0x00, 0x5E, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAC, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x8E, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCE, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x34, 0x58, 0x60,
+    0x51, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t fontTitleVlw[9478] = {
+    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A,
+    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0E,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x20, 0x20, 0x20, 0x20, 0x06, 0x2D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2D, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0x17,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0xFD, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xEB, 0xFF, 0xFF,
+    0xEB, 0x00, 0x00, 0xDA, 0xFF, 0xFF, 0xDA, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0xB6,
+    0xFF, 0xFF, 0xB6, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0x92, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2A, 0x60, 0x60, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x52, 0xA6, 0xA6, 0x52, 0x00, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0xE5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE5, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
+    0x32, 0xEA, 0xFF, 0xFF, 0xEA, 0x32, 0x00, 0x0E, 0x50, 0x50, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x69, 0x8F, 0x8F, 0x8F, 0x8F, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0x97, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE5, 0xFF, 0xFF, 0xAF, 0xDB, 0xFF, 0xFF,
+    0xE5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xFF, 0xFF, 0xFF, 0x74, 0x9B,
+    0xFF, 0xFF, 0xFF, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xFF, 0xFF, 0xFF,
+    0x38, 0x5D, 0xFF, 0xFF, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF,
+    0xFF, 0xF5, 0x05, 0x20, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+    0xFF, 0xFF, 0xFF, 0xBB, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x76, 0xFF, 0xFF, 0xFF, 0x7B, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0x76, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xC5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0xFD, 0xFF, 0xFF, 0xF7, 0x24, 0x20, 0x20, 0x40, 0xFF, 0xFF, 0xFF,
+    0xFD, 0x17, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x0C, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0C, 0x00, 0x00, 0x54, 0xFF, 0xFF, 0xFF, 0xEC,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x66, 0xFE, 0xFF, 0xFF, 0xFF, 0x54, 0x00, 0x00, 0xA3, 0xFF, 0xFF,
+    0xFF, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x05, 0xEE,
+    0xFF, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xEE, 0x05,
+    0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x43, 0x92, 0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x92, 0x48, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8A, 0x78, 0x53, 0x17, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xA9, 0x18,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x10,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFD, 0xDF, 0xDF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x3B, 0xEA, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFF, 0xCC, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x80, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0xFF, 0xFF, 0xFD, 0x39, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFA, 0xAF, 0xAF, 0xC3, 0xFB, 0xFF, 0xFF, 0xFA, 0x66, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA9, 0x18, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xF6, 0x70, 0x70,
+    0x79, 0x9E, 0xEF, 0xFF, 0xFF, 0xFF, 0xD9, 0x0C, 0x80, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00,
+    0x00, 0x1D, 0xED, 0xFF, 0xFF, 0xFF, 0x6F, 0x80, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA6, 0xFF, 0xFF, 0xFF, 0xA7, 0x80, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAE, 0xFF, 0xFF, 0xFF, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xF5,
+    0xFF, 0xFF, 0xFF, 0x95, 0x80, 0xFF, 0xFF, 0xFF, 0xF6, 0x70, 0x70, 0x74, 0xA1, 0xF6, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x47, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x9F, 0x0A,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xCA, 0x8F, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4B, 0x9B, 0xCE, 0xE8, 0xE6, 0xC6, 0x80, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x73,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x82, 0x00, 0x00, 0x00, 0x44, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEB, 0xFF, 0xFF,
+    0xFF, 0xDB, 0x15, 0x00, 0x00, 0x09, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x26, 0x00, 0x00, 0x28,
+    0xA9, 0xE9, 0x24, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0xCB, 0xFF, 0xFF, 0xFF, 0xEB, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x43, 0x00, 0x00, 0x00, 0x00, 0x39, 0xDF, 0x49, 0x00, 0x00,
+    0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBB, 0x80, 0x77, 0xB0, 0xFD, 0xFF, 0xF5, 0x38,
+    0x00, 0x00, 0x00, 0x11, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xD4, 0x01, 0x00, 0x00, 0x00, 0x15, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xDD, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x57, 0xC6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC,
+    0x86, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x43, 0x5B, 0x53, 0x33,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x09, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x80, 0x62, 0x2C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9,
+    0x65, 0x02, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBA, 0x0F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBD, 0x03, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x06, 0x28, 0x7B, 0xF1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x6A, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x2E, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x81,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x27,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xFF, 0xFF, 0x98, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xFF, 0xFF, 0xAB, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xFF, 0xFF, 0xAF, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE9, 0xFF, 0xFF, 0xFF, 0x9C, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x13,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x09, 0xD9,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x0C, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x1A, 0xB9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x93, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0x95, 0xBC, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE9, 0x15, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF2, 0x3C, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCB, 0x2D, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xD5, 0x9E, 0x48,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x6C, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBF, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x30,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x30, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x64, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x24, 0x30, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+    0xEF, 0x69, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x30,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x54, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x12, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xBF, 0xFF, 0xFF, 0xFF, 0xB1, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x06, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xBD, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x46, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC9, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x62, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x7B, 0xBB, 0xE0, 0xED, 0xD6,
+    0xA3, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x87, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAE, 0x14, 0x00, 0x00, 0x00, 0x0A, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0x00, 0x00, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE2, 0xFA,
+    0xFF, 0xFF, 0xF9, 0x46, 0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x63, 0x07, 0x00, 0x09,
+    0x6C, 0xF3, 0x5E, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x26, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xFB, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xAF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xA2, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x00, 0x00, 0x36, 0x8F, 0x8F,
+    0xCE, 0xFF, 0xFF, 0xFF, 0x70, 0x56, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x70, 0x12, 0xF9, 0xFF, 0xFF, 0xFF, 0xCB, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x98, 0x04, 0x00, 0x00, 0x00,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x22, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0x8E, 0x73, 0x96,
+    0xF1, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x5D, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x5B, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB3, 0x12, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x99, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xC1, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x33, 0x54, 0x5D, 0x46,
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x09, 0x8F, 0x8F, 0x8F, 0x8F, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xCF, 0xCF, 0xCF, 0xCF, 0xDE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x6C, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x6C, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x24, 0x30, 0x30,
+    0x30, 0x64, 0xFF, 0xFF, 0xFF, 0xFF, 0x64, 0x30, 0x30, 0x30, 0x24, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xBF, 0xBF, 0xBF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xBF,
+    0xBF, 0xBF, 0x8F, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x51,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x48, 0x00, 0x00, 0x8F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x12, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0xF1, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x7D, 0x00,
+    0x00, 0x0A, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0x00, 0x05,
+    0xB1, 0xFC, 0x6E, 0x01, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x01, 0xA4, 0xFF,
+    0xFF, 0xFF, 0xD0, 0x81, 0x79, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x06, 0x0E, 0xDE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x22, 0xD4, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x01, 0x00, 0x00, 0x00, 0x08, 0x7D, 0xE7, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x54,
+    0x5D, 0x4A, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x8F, 0x8F, 0x8F, 0x48, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x75, 0x8F, 0x8F, 0x8F, 0x8A, 0x0B, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x26, 0xF3, 0xFF, 0xFF, 0xFF, 0xB2, 0x01, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x06,
+    0xCC, 0xFF, 0xFF, 0xFF, 0xE1, 0x12, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8A,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x39, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x46, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x16, 0xE6, 0xFF,
+    0xFF, 0xFF, 0xB2, 0x01, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0xB4, 0xFF, 0xFF,
+    0xFF, 0xE1, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF6, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x3E, 0xD5,
+    0xFF, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0x00, 0x58,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x45, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xB7, 0x01, 0x00, 0x02,
+    0xD5, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x01, 0xCE, 0xFF, 0xFF, 0xFF, 0xE0, 0x08, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xCE, 0xFF, 0xFF, 0xFF, 0xEE, 0x11, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x75, 0x8F, 0x8F, 0x8F, 0x5A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xE7, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x3C, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x50, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x50, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+    0x09, 0x8F, 0x8F, 0x8F, 0x8F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0x8F, 0x8F, 0x8F, 0x09,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0x03, 0x00, 0x00, 0x02, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x32, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xF9, 0xFC, 0xFF, 0x83, 0x00, 0x00, 0x78, 0xFF, 0xFA, 0xFC, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xF7, 0xC9, 0xFF, 0xCD, 0x00, 0x00, 0xBD, 0xFF, 0xC6, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x8E, 0xFF, 0xFE, 0x18, 0x0A, 0xF8, 0xFF, 0x92, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x5F, 0x48, 0xFF, 0xFF, 0x5E, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x39, 0xF2, 0xFF, 0x9C, 0x87, 0xFF, 0xE3, 0x44, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x46, 0xB0, 0xFF, 0xDB, 0xC3, 0xFF, 0x9B, 0x55, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x56, 0x67, 0xFF, 0xFF, 0xFD, 0xFF, 0x4F, 0x66, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x64, 0x16, 0xFC, 0xFF, 0xFF, 0xF3, 0x09, 0x73, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0xC2, 0xFF, 0xFF, 0xA9, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x6E, 0xFF, 0xFF, 0x58, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x1E, 0xBF, 0xBE, 0x0C, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x10,
+    0x10, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x10,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x56, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x8F, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE8, 0x06, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5A, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
+    0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x00,
+    0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFC, 0xFF, 0xF8, 0x15, 0x00, 0x30, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xB2, 0xFF, 0xFF, 0x7A, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD9, 0x50, 0xFF, 0xFF, 0xE2, 0x04, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x04, 0xE5, 0xFF, 0xFF, 0x53, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x16, 0x82, 0xFF, 0xFF, 0xBC, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x1B,
+    0xFB, 0xFF, 0xFE, 0x23, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0xA9, 0xFF,
+    0xFF, 0x85, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x3E, 0xFF, 0xFF, 0xE6,
+    0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xE7, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x0A, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x21, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x82, 0xC6, 0xE7,
+    0xE7, 0xC6, 0x82, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xF7, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF7, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x3E, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3B, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0xFE, 0x6E, 0x03,
+    0x03, 0x6E, 0xFE, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x00, 0x00,
+    0x00, 0x00, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x76, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00,
+    0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0xA8, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xA7, 0xC8, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xC8, 0xD9, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xD9, 0xDD, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xDD, 0xCC, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xB8, 0xFF, 0xFF, 0xFF, 0xCC, 0xB2, 0xFF, 0xFF, 0xFF, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD9, 0xFF, 0xFF, 0xFF, 0xB2, 0x86, 0xFF, 0xFF, 0xFF, 0xFD, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0xFD, 0xFF, 0xFF, 0xFF, 0x86, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00,
+    0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xE9, 0x1C, 0x00,
+    0x00, 0x1C, 0xE9, 0xFF, 0xFF, 0xFF, 0xE3, 0x03, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x84,
+    0x84, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x03, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x03, 0x00, 0x00, 0x00, 0x15, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7D, 0xEB, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEB, 0x7D, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x36, 0x58,
+    0x58, 0x36, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x84, 0x66, 0x34, 0x02, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0x5E, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x89, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0xEF, 0xEF, 0xF5, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x44, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x16, 0x74, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xB1, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0xEA, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC7, 0xFF, 0xFF, 0xFF, 0xCE, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xAB, 0x20, 0x20, 0x2A, 0x51, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x0D, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2B, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x86, 0x0F, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3,
+    0x60, 0x60, 0x60, 0x4F, 0x2B, 0x02, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x8C, 0xCC, 0xE8, 0xE5, 0xC0, 0x7B, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF1, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x21, 0x00, 0x00, 0x01, 0xD4, 0xFF, 0xFF, 0xFF, 0xFA, 0x5C, 0x01,
+    0x06, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x00,
+    0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xF6, 0x0C, 0x00, 0x84, 0xFF, 0xFF, 0xFF, 0xFD, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0xB7, 0xFF, 0xFF, 0xFF, 0xD5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFB, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0xD8, 0xFF, 0xFF, 0xFF,
+    0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0xE8, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xEA, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xDC,
+    0xFF, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFF, 0xFF, 0xFF, 0xA7, 0x00,
+    0xC2, 0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xFF, 0xFF, 0xFF, 0x8D,
+    0x00, 0x97, 0xFF, 0xFF, 0xFF, 0xF6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x63, 0x00, 0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x21, 0x00, 0x0C, 0xF1, 0xFF, 0xFF, 0xFF, 0xDC, 0x0F, 0x00, 0x00, 0x2B, 0xF4, 0xFF, 0xFF,
+    0xFF, 0xC7, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x80, 0x8A, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x08, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBA, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x8A, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE9, 0x74, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xCA, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x6F, 0x3C, 0x3F, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x5C, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x43, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x49, 0x50, 0x46, 0x14, 0x00, 0x7E, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x7B, 0x5A, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBB, 0x2B, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x3D, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xF7, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x08, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0x2B, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE9, 0xFF, 0xFF, 0xFF, 0x85, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE5, 0xFF, 0xFF, 0xFF, 0x87, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xC7, 0x8F, 0x8F, 0x9E, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x0B, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x4F, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x50, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xF7, 0xEF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x06, 0xDC, 0xFF, 0xFF, 0xFF, 0xD7, 0x04, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xD0, 0xFF, 0xFF, 0xFF, 0xEB, 0x10, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xF9, 0x23, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x72, 0xB9, 0xDD, 0xEE, 0xD9, 0xB0, 0x68, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x64, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x74, 0x03, 0x00, 0x00, 0x00,
+    0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x23,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE0, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x4C, 0x00, 0x00, 0x84,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x5E, 0x03, 0x00, 0x03, 0x3A, 0xAF, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xFF, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x01, 0x00, 0x00, 0x00, 0xAB,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x9A, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0x5F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4D, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x7B, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x37, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x1B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x44, 0xB0, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0x00, 0x00,
+    0x14, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x06,
+    0xC1, 0xF8, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x65, 0x00, 0x9F,
+    0xFF, 0xFF, 0xFF, 0xF3, 0xA9, 0x7B, 0x77, 0x9E, 0xF5, 0xFF, 0xFF, 0xFF, 0xF8, 0x18, 0x41, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x53,
+    0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x71, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBC, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x43, 0x5A, 0x59, 0x41, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x09,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x03, 0x30, 0x30, 0x30, 0x30, 0x30, 0x64, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x64, 0x30, 0x30, 0x30, 0x30, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x8F, 0x8F, 0x8F, 0x8F, 0x2D, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x8F, 0x8F, 0x8F, 0x8F, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0x00, 0x00, 0x00, 0x00,
+    0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xED, 0xFF, 0xFF, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00,
+    0x5D, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xBA, 0xFF, 0xFF, 0xFF, 0xE2, 0x0F, 0x00, 0x00, 0x06,
+    0xC7, 0xFF, 0xFF, 0xFF, 0xBB, 0x00, 0x00, 0x67, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x80, 0x7C, 0xCD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x00, 0x00, 0x09, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE3, 0x0B, 0x00, 0x00, 0x00, 0x33, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF3, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xA9, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0xB2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x3E, 0x56, 0x58, 0x42,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x8F, 0x8F, 0x8F, 0x8F, 0x1C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x8E, 0x8F, 0x8F, 0x8F, 0x43, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x03, 0xEA, 0xFF, 0xFF, 0xFF, 0xA7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFF, 0xFF, 0xFF, 0xEB, 0x03, 0x00, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xE9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x53,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x00,
+    0x00, 0x0C, 0xF8, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xF9,
+    0x0E, 0x00, 0x00, 0x00, 0xB7, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF,
+    0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0xED, 0x02, 0x00, 0x00, 0x00, 0xBB,
+    0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00,
+    0x07, 0xF5, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x74,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFF, 0xFF,
+    0xFF, 0xB9, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+    0xFF, 0xFF, 0xFF, 0xF5, 0x06, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xE6, 0xFF, 0xFF, 0xFF, 0x38, 0x06, 0xF7, 0xFF, 0xFF, 0xEA, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0x74, 0x3C, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xB0, 0x7E, 0xFF, 0xFF, 0xFF, 0x53,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF6, 0xFF, 0xFF, 0xEE, 0xC7, 0xFF, 0xFF,
+    0xF8, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x8F,
+    0x8F, 0x8F, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x8F, 0x8F, 0x8F, 0x7A,
+    0xBC, 0xFF, 0xFF, 0xFF, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x9A, 0xFF, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x79, 0xFF, 0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0x80, 0x56, 0xFF, 0xFF, 0xFF, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x1E,
+    0x8F, 0x8F, 0x57, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xFF, 0x40, 0x12, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x68, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0xA6, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0xEF, 0xFF, 0xFF,
+    0xFF, 0x0C, 0x00, 0xA7, 0xFF, 0xFF, 0xFB, 0x0B, 0x00, 0xB3, 0xFF, 0xFF, 0xFB, 0x04, 0x00, 0xCD,
+    0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0x43, 0x00, 0xC1, 0xFF, 0xFF, 0xDF, 0x00,
+    0x00, 0xAB, 0xFF, 0xFF, 0xFF, 0x2B, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xCF, 0xFF, 0xFF,
+    0xC1, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0x3B, 0x68, 0xFF, 0xEC, 0xE9, 0xFF, 0xBB, 0x00, 0xDF,
+    0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x67, 0xFF, 0xFF, 0xFF, 0x40, 0x9D, 0xFF, 0xCD, 0xCB, 0xFF, 0xF2,
+    0x02, 0xEC, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x45, 0xFF, 0xFF, 0xFF, 0x4E, 0xD3, 0xFF, 0xA9, 0xA3,
+    0xFF, 0xFF, 0x28, 0xEF, 0xFF, 0xFF, 0x62, 0x00, 0x00, 0x23, 0xFF, 0xFF, 0xFF, 0x5F, 0xFD, 0xFF,
+    0x7F, 0x77, 0xFF, 0xFF, 0x5F, 0xF6, 0xFF, 0xFF, 0x42, 0x00, 0x00, 0x05, 0xFB, 0xFF, 0xFF, 0x99,
+    0xFF, 0xFF, 0x4E, 0x45, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0xFF, 0x22, 0x00, 0x00, 0x00, 0xDE, 0xFF,
+    0xFF, 0xDC, 0xFF, 0xFF, 0x1E, 0x12, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x05, 0x00, 0x00, 0x00,
+    0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00,
+    0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1,
+    0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0x00, 0x00, 0x78, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0x00, 0x45, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x04, 0x87, 0x8F, 0x8F, 0x8F, 0x86, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6A, 0x8F, 0x8F, 0x8F, 0x88, 0x04, 0x00, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xFF, 0x8B, 0x00, 0x00, 0x0E, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xDB, 0x04, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0xFF, 0xEC, 0x10, 0x00, 0x00, 0x00, 0x67, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x62, 0x00, 0x00, 0x16, 0xF6, 0xFF, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xD2, 0xFF, 0xFF, 0xFF, 0xDE, 0x04, 0x00, 0x85, 0xFF, 0xFF, 0xFF, 0xDC, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x08, 0xEC, 0xFF, 0xFF, 0xFF, 0x55, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xD5, 0x5E, 0xFF, 0xFF, 0xFF, 0xC6,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFB, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF,
+    0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x36, 0xFE, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xF9, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xC4, 0xFF, 0xFF, 0xFF, 0x72, 0xD1, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFF, 0xFF, 0xFF, 0xEF, 0x0E, 0x59, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xDF, 0xFF, 0xFF, 0xFF, 0x86, 0x00, 0x04, 0xD7, 0xFF,
+    0xFF, 0xFF, 0xD5, 0x04, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xFF, 0xFF, 0xF3, 0x14, 0x00, 0x00,
+    0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x18, 0xF2, 0xFF, 0xFF, 0xFF, 0x87, 0x00,
+    0x00, 0x00, 0x01, 0xCA, 0xFF, 0xFF, 0xFF, 0xEE, 0x14, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x00, 0x30, 0xFD, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xFF, 0xFF, 0xFF, 0xFC, 0x2E, 0x38, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0x8F, 0x8F, 0x8F, 0x38,
+    0x10, 0xEF, 0xFF, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x10, 0x00, 0x85, 0xFF, 0xFF, 0xFF, 0xFA, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xED, 0xFF,
+    0xFF, 0xFF, 0x85, 0x00, 0x00, 0x14, 0xF3, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x62,
+    0xFF, 0xFF, 0xFF, 0xF3, 0x14, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0xE7, 0x06, 0x00, 0x00,
+    0x00, 0xCE, 0xFF, 0xFF, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x19, 0xF6, 0xFF, 0xFF, 0xFF, 0x54,
+    0x00, 0x00, 0x38, 0xFF, 0xFF, 0xFF, 0xF6, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF,
+    0xFF, 0xB6, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+    0xF9, 0xFF, 0xFF, 0xFD, 0x22, 0x12, 0xF6, 0xFF, 0xFF, 0xF9, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x97, 0xFF, 0xFF, 0xFF, 0x85, 0x72, 0xFF, 0xFF, 0xFF, 0x97, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x23, 0xFB, 0xFF, 0xFF, 0xE7, 0xDD, 0xFF, 0xFF, 0xFB, 0x23, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x2D, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x18, 0x00, 0x0E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x82,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xF3,
+    0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC5, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xFA, 0xFF, 0xFF,
+    0xFF, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xD6, 0xFF, 0xFF, 0xFF,
+    0xD1, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFE, 0xFF, 0xFF, 0xFF, 0x77,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xE4, 0xFF, 0xFF, 0xFF, 0xC1, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0xFF, 0xFF, 0xF1, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0x61, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xEF, 0xFF, 0xFF, 0xFF, 0xAD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x54, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70,
+};
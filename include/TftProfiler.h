@@ -0,0 +1,122 @@
+// TftProfiler.h - Attributes panel bus time to the code that drew
+//
+// A TFT_eSPI that forwards every leaf draw call (fills, lines, glyphs) to
+// the panel and times it. Each call is charged to the current context (the
+// screen) plus the stack of TFT_PROFILE_SCOPE()/TFT_PROFILE_TAG() scopes it
+// was made under, so "quiz;drawQuizScreen;fillRoundedRect" gets its own
+// calls, pixels, bytes, transactions and microseconds. Frame totals are
+// kept per context. The table can be dumped as folded stacks, one line per
+// call site, ready for flamegraph.pl or speedscope.
+//
+// The profiler adds a timer read per draw call - compare sites against each
+// other, not against unprofiled builds.
+
+#pragma once
+
+#include <TFT_eSPI.h>
+
+// 1 builds the profiler and the scope macros; 0 compiles them away
+#ifndef TFT_PROFILER
+#define TFT_PROFILER 0
+#endif
+
+#define TFT_PROFILE_DEPTH 4          // Nested scopes kept per call site
+#define TFT_PROFILE_SITES 96         // Distinct context + scope stacks
+#define TFT_PROFILE_CONTEXTS 12      // Screens with their own frame totals
+#define TFT_PROFILE_WINDOW_BYTES 11  // CASET + RASET + RAMWR per transaction
+
+struct TftSiteStats {
+    uint32_t calls;
+    uint32_t pixels;
+    uint32_t bytes;
+    uint32_t transactions;
+    uint32_t us;
+};
+
+struct TftSite {
+    const char* context;
+    const char* scopes[TFT_PROFILE_DEPTH];
+    uint8_t depth;
+    TftSiteStats stats;
+};
+
+struct TftFrameStats {
+    const char* context;
+    uint32_t frames;
+    uint32_t us;          // Bus time across all frames
+    uint32_t worstUs;
+};
+
+enum TftFoldedValue : uint8_t {
+    FOLD_US,
+    FOLD_BYTES,
+    FOLD_PIXELS,
+    FOLD_TRANSACTIONS
+};
+
+class TftProfiler : public TFT_eSPI {
+public:
+    explicit TftProfiler(TFT_eSPI* target);
+
+    // Copies the target's size and rotation. context() names the current
+    // screen and is called once per draw.
+    void begin(const char* (*context)());
+
+    // Charges a raw pixel push that went straight to the panel
+    void recordPush(uint32_t pixels, int64_t startUs);
+
+    // Closes the current frame's bus-time total
+    void endFrame();
+
+    void reset();
+    void printTable(Print& out);
+    void printFolded(Print& out, TftFoldedValue value);
+
+    // Scope stack, maintained by TftScope
+    static void pushScope(const char* name);
+    static void popScope();
+
+    // Forwarded to the target and charged
+    void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+    void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) override;
+    void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) override;
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override;
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override;
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+
+    int16_t width() override { return _width; }
+    int16_t height() override { return _height; }
+
+private:
+    TftSite* site();
+    void charge(uint32_t pixels, int64_t startUs);
+    void printStack(Print& out, const TftSite& s);
+
+    TFT_eSPI* target;
+    const char* (*context)();
+    TftSite sites[TFT_PROFILE_SITES];
+    uint16_t numSites;
+    uint32_t droppedCalls;          // Site table full
+    TftFrameStats frames[TFT_PROFILE_CONTEXTS];
+    uint8_t numContexts;
+    uint32_t frameUs;
+    const char* frameContext;
+    TftSite* lastSite;
+
+    static const char* scopes[TFT_PROFILE_DEPTH];
+    static uint8_t depth;           // May exceed TFT_PROFILE_DEPTH
+};
+
+class TftScope {
+public:
+    explicit TftScope(const char* name) { TftProfiler::pushScope(name); }
+    ~TftScope() { TftProfiler::popScope(); }
+};
+
+#if TFT_PROFILER
+#define TFT_PROFILE_SCOPE() TftScope tftScope_(__func__)
+#define TFT_PROFILE_TAG(tag) TftScope tftScope_(tag)
+#else
+#define TFT_PROFILE_SCOPE()
+#define TFT_PROFILE_TAG(tag)
+#endif
@@ -0,0 +1,129 @@
+// TouchFilter.h - Resistive touch filtering and fixed-point calibration
+//
+// Single XPT2046 conversions jump by tens of counts, and more while the
+// finger is still pressing down. TouchFilter takes a short burst of raw
+// conversions, keeps the median of each axis and throws the burst away if
+// its middle values are spread too wide, then smooths accepted points with
+// a first-order IIR for as long as the finger stays down.
+//
+// TouchCalibration maps raw counts to screen pixels with an affine fit
+// from three touched targets, stored as Q16 fixed point - applying it is
+// four multiplies and two shifts, and it absorbs offset, scale, rotation
+// and skew of the panel at once. No hardware in here.
+
+#pragma once
+
+#include <stdint.h>
+
+#define TOUCH_BURST 5            // Raw conversions per sample (odd, max 9)
+#define TOUCH_MAX_SPREAD 48      // Raw counts allowed between the inner burst values
+#define TOUCH_IIR_SHIFT 2        // Each accepted sample moves the point 1/4 of the way
+#define TOUCH_CAL_POINTS 3
+#define TOUCH_CAL_MIN_DET 20000  // Smaller = targets too close or in a line
+
+// x = (ax * rawX + bx * rawY + cx) >> 16, same for y. Coefficients are kept
+// below 1.0 and offsets below 2^29, so the sum always fits in an int32.
+struct TouchCalibration {
+    int32_t ax, bx, cx;
+    int32_t ay, by, cy;
+};
+
+inline void touchMap(const TouchCalibration& cal, int32_t rawX, int32_t rawY, int& x, int& y) {
+    x = (cal.ax * rawX + cal.bx * rawY + cal.cx + 0x8000) >> 16;
+    y = (cal.ay * rawX + cal.by * rawY + cal.cy + 0x8000) >> 16;
+}
+
+// Fits the calibration through three raw/screen point pairs. One-off, so
+// it is free to use 64-bit math. Returns false if the points can't give a
+// usable fit.
+inline bool touchSolve(const int32_t raw[TOUCH_CAL_POINTS][2],
+                       const int32_t screen[TOUCH_CAL_POINTS][2],
+                       TouchCalibration& cal) {
+    int64_t rx0 = raw[0][0] - raw[2][0], ry0 = raw[0][1] - raw[2][1];
+    int64_t rx1 = raw[1][0] - raw[2][0], ry1 = raw[1][1] - raw[2][1];
+    int64_t det = rx0 * ry1 - rx1 * ry0;
+    if (det > -TOUCH_CAL_MIN_DET && det < TOUCH_CAL_MIN_DET) return false;
+
+    int32_t* coef[2][3] = {{&cal.ax, &cal.bx, &cal.cx}, {&cal.ay, &cal.by, &cal.cy}};
+    for (int axis = 0; axis < 2; axis++) {
+        int64_t s0 = screen[0][axis] - screen[2][axis];
+        int64_t s1 = screen[1][axis] - screen[2][axis];
+        int64_t a = ((s0 * ry1 - s1 * ry0) * 65536 + det / 2) / det;
+        int64_t b = ((rx0 * s1 - rx1 * s0) * 65536 + det / 2) / det;
+        int64_t c = ((int64_t)screen[2][axis] << 16) - a * raw[2][0] - b * raw[2][1];
+
+        if (a <= -65536 || a >= 65536 || b <= -65536 || b >= 65536) return false;
+        if (c <= -(1LL << 29) || c >= (1LL << 29)) return false;
+        *coef[axis][0] = (int32_t)a;
+        *coef[axis][1] = (int32_t)b;
+        *coef[axis][2] = (int32_t)c;
+    }
+    return true;
+}
+
+class TouchFilter {
+public:
+    TouchFilter() : down(false), fx(0), fy(0), accepted(0), rejected(0) {}
+
+    // Feeds one burst of raw conversions. Returns false if it was too noisy
+    // to use - the previous point (if any) still stands.
+    bool addBurst(const uint16_t* xs, const uint16_t* ys, uint8_t count) {
+        int32_t mx, my;
+        if (!median(xs, count, mx) || !median(ys, count, my)) {
+            rejected++;
+            return false;
+        }
+        accepted++;
+
+        // State is raw << 4 so the IIR doesn't lose the low bits
+        if (!down) {
+            fx = mx << 4;
+            fy = my << 4;
+            down = true;
+        } else {
+            fx += ((mx << 4) - fx) >> TOUCH_IIR_SHIFT;
+            fy += ((my << 4) - fy) >> TOUCH_IIR_SHIFT;
+        }
+        return true;
+    }
+
+    // Finger lifted - the next burst starts a fresh point
+    void release() { down = false; }
+
+    bool pressed() const { return down; }
+    int32_t rawX() const { return (fx + 8) >> 4; }
+    int32_t rawY() const { return (fy + 8) >> 4; }
+
+    uint32_t acceptedBursts() const { return accepted; }
+    uint32_t rejectedBursts() const { return rejected; }
+
+private:
+    static bool median(const uint16_t* in, uint8_t count, int32_t& out) {
+        uint16_t v[9];
+        if (count == 0 || count > 9) return false;
+
+        // Insertion sort - at most 9 values
+        for (uint8_t i = 0; i < count; i++) {
+            uint16_t value = in[i];
+            int j = i - 1;
+            while (j >= 0 && v[j] > value) {
+                v[j + 1] = v[j];
+                j--;
+            }
+            v[j + 1] = value;
+        }
+
+        // The outer values may be the settling edge - judge by the rest
+        uint8_t lo = count > 2 ? 1 : 0;
+        uint8_t hi = count > 2 ? count - 2 : count - 1;
+        if (v[hi] - v[lo] > TOUCH_MAX_SPREAD) return false;
+
+        out = v[count / 2];
+        return true;
+    }
+
+    bool down;
+    int32_t fx, fy;
+    uint32_t accepted;
+    uint32_t rejected;
+};
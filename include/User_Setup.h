@@ -62,7 +62,7 @@
 // SPI configuration
 // ##################################################################################
 #define SPI_FREQUENCY       65000000
-#define SPI_READ_FREQUENCY  80000000
+#define SPI_READ_FREQUENCY  20000000   // GRAM read-back ('shot'); the ILI9341 reads far slower than it writes
 #define SPI_TOUCH_FREQUENCY  2500000
 
 // IMPORTANT: Use HSPI for display (pins 12,13,14 are HSPI)
@@ -0,0 +1,271 @@
+// GoldenMain.cpp - Golden images and draw costs for every screen fixture
+//
+// Boots the firmware (built with SCREEN_FIXTURES=1) on the fast clock, then
+// draws each screen fixture from src/main.cpp and checks it one of two ways:
+//
+//   images   the panel against <golden>/<name>.png. A pixel differs when an
+//            8-bit channel is off by more than --tolerance, and a fixture
+//            fails with more than --max-pixels of them. The screen and a
+//            diff (differing pixels in red) are saved in --out.
+//   costs    pixels written and draw calls against <golden>/costs.txt. A
+//            fixture fails when either grows more than --slack percent.
+//
+//   cyd-golden images [--golden DIR] [--out DIR] [--tolerance N] [--max-pixels N]
+//   cyd-golden costs [--golden DIR] [--costs FILE] [--slack PCT]
+//   cyd-golden update [--golden DIR] [--costs FILE]
+//
+// 'update' rewrites the images and costs from this build. Look at what
+// changed before committing them. --costs keeps a build's costs apart from
+// the images it shares with another (default <golden>/costs.txt).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "PngFile.h"
+#include "SimHost.h"
+
+// From src/main.cpp
+void setup();
+const char* screenFixtureName(int index);
+void loadScreenFixture(int index);
+void drawScreenFixture(int index);
+
+#define GOLDEN_SEED 1
+
+struct Options {
+    std::string mode;
+    std::string golden = "golden";
+    std::string out = ".";
+    std::string costs;              // Empty - <golden>/costs.txt
+    int tolerance = 8;              // Per 8-bit channel
+    int maxPixels = 0;
+    double slack = 5.0;             // Percent
+};
+
+struct Cost {
+    uint32_t pixels;
+    uint32_t primitives;
+};
+
+// 5 and 6 bit channels widened as PngFile does
+static void channels(uint16_t c, int* rgb) {
+    int r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+static bool pixelsMatch(uint16_t a, uint16_t b, int tolerance) {
+    if (a == b) return true;
+    int ca[3], cb[3];
+    channels(a, ca);
+    channels(b, cb);
+    for (int i = 0; i < 3; i++) {
+        if (abs(ca[i] - cb[i]) > tolerance) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// IMAGES
+// ============================================================================
+
+static bool checkImage(const Options& options, const char* name) {
+    std::string path = options.golden + "/" + name + ".png";
+    std::vector<uint16_t> golden;
+    int w = 0, h = 0;
+    if (!readPng(path.c_str(), golden, w, h)) {
+        printf("  %-18s FAIL  cannot read %s - 'cyd-golden update' makes it\n", name, path.c_str());
+        return false;
+    }
+    if (w != SIM_WIDTH || h != SIM_HEIGHT) {
+        printf("  %-18s FAIL  %s is %dx%d\n", name, path.c_str(), w, h);
+        return false;
+    }
+
+    // Differing pixels red, the rest the screen dimmed to a quarter
+    std::vector<uint16_t> diff(SIM_WIDTH * SIM_HEIGHT);
+    int bad = 0, firstX = -1, firstY = -1;
+    for (int y = 0; y < SIM_HEIGHT; y++) {
+        for (int x = 0; x < SIM_WIDTH; x++) {
+            uint16_t actual = simGram[y][x];
+            if (pixelsMatch(actual, golden[y * SIM_WIDTH + x], options.tolerance)) {
+                diff[y * SIM_WIDTH + x] = (actual >> 2) & 0x39E7;
+                continue;
+            }
+            diff[y * SIM_WIDTH + x] = 0xF800;
+            if (bad++ == 0) {
+                firstX = x;
+                firstY = y;
+            }
+        }
+    }
+
+    if (bad <= options.maxPixels) {
+        printf("  %-18s ok    %d pixels differ\n", name, bad);
+        return true;
+    }
+    std::string actualPath = options.out + "/" + name + ".actual.png";
+    std::string diffPath = options.out + "/" + name + ".diff.png";
+    writePng(actualPath.c_str(), &simGram[0][0], SIM_WIDTH, SIM_HEIGHT);
+    writePng(diffPath.c_str(), diff.data(), SIM_WIDTH, SIM_HEIGHT);
+    printf("  %-18s FAIL  %d pixels differ, first at (%d, %d) - see %s\n",
+           name, bad, firstX, firstY, diffPath.c_str());
+    return false;
+}
+
+// ============================================================================
+// COSTS
+// ============================================================================
+
+static std::string costsPath(const Options& options) {
+    return options.costs.empty() ? options.golden + "/costs.txt" : options.costs;
+}
+
+static bool readCosts(const Options& options, std::map<std::string, Cost>& costs) {
+    FILE* f = fopen(costsPath(options).c_str(), "r");
+    if (!f) return false;
+    char line[128], name[64];
+    Cost cost;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%63s %u %u", name, &cost.pixels, &cost.primitives) == 3) {
+            costs[name] = cost;
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+// Percent change from the baseline
+static double growth(uint32_t now, uint32_t base) {
+    if (base == 0) return now == 0 ? 0.0 : 100.0;
+    return ((double)now - base) * 100.0 / base;
+}
+
+static bool checkCost(const Options& options, const char* name, const Cost& cost,
+                      const std::map<std::string, Cost>& costs) {
+    auto it = costs.find(name);
+    if (it == costs.end()) {
+        printf("  %-18s FAIL  not in %s - 'cyd-golden update' adds it\n", name, costsPath(options).c_str());
+        return false;
+    }
+    double pixels = growth(cost.pixels, it->second.pixels);
+    double primitives = growth(cost.primitives, it->second.primitives);
+    bool ok = pixels <= options.slack && primitives <= options.slack;
+    bool better = pixels < -options.slack || primitives < -options.slack;
+
+    printf("  %-18s %-5s %6u px (%+.1f%%)  %5u draws (%+.1f%%)%s\n",
+           name, ok ? "ok" : "FAIL", cost.pixels, pixels, cost.primitives, primitives,
+           better ? "  - below baseline, 'update' to keep it" : "");
+    return ok;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+static void usage() {
+    fprintf(stderr,
+            "Usage: cyd-golden images|costs|update [options]\n"
+            "  --golden DIR       golden images and costs.txt (default ./golden)\n"
+            "  --out DIR          where failed images and diffs go (default .)\n"
+            "  --costs FILE       draw costs (default <golden>/costs.txt)\n"
+            "  --tolerance N      per-channel difference still counted equal (default 8)\n"
+            "  --max-pixels N     differing pixels allowed per screen (default 0)\n"
+            "  --slack PCT        draw cost growth allowed (default 5)\n");
+}
+
+static bool parseArgs(int argc, char** argv, Options& options) {
+    if (argc < 2) {
+        usage();
+        return false;
+    }
+    options.mode = argv[1];
+    if (options.mode != "images" && options.mode != "costs" && options.mode != "update") {
+        usage();
+        return false;
+    }
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--golden" && hasValue) {
+            options.golden = argv[++i];
+        } else if (arg == "--out" && hasValue) {
+            options.out = argv[++i];
+        } else if (arg == "--costs" && hasValue) {
+            options.costs = argv[++i];
+        } else if (arg == "--tolerance" && hasValue) {
+            options.tolerance = atoi(argv[++i]);
+        } else if (arg == "--max-pixels" && hasValue) {
+            options.maxPixels = atoi(argv[++i]);
+        } else if (arg == "--slack" && hasValue) {
+            options.slack = atof(argv[++i]);
+        } else {
+            usage();
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) return 2;
+
+    std::map<std::string, Cost> costs;
+    if (options.mode == "costs" && !readCosts(options, costs)) {
+        fprintf(stderr, "golden: cannot read %s - 'cyd-golden update' makes it\n", costsPath(options).c_str());
+        return 1;
+    }
+
+    // The firmware's own log would bury the report
+    simSeed = GOLDEN_SEED;
+    simSerialMuted = true;
+    simClockBegin(true, 1.0);
+    setup();
+
+    FILE* costsOut = nullptr;
+    if (options.mode == "update") {
+        costsOut = fopen(costsPath(options).c_str(), "w");
+        if (!costsOut) {
+            fprintf(stderr, "golden: cannot write %s\n", costsPath(options).c_str());
+            return 1;
+        }
+        fprintf(costsOut, "# fixture pixels draws - written by 'cyd-golden update'\n");
+    }
+
+    int failed = 0, count = 0;
+    for (int i = 0; screenFixtureName(i); i++, count++) {
+        const char* name = screenFixtureName(i);
+        loadScreenFixture(i);
+        simTakeCounters();
+        drawScreenFixture(i);
+        SimPanelCounters drawn = simTakeCounters();
+        Cost cost = {drawn.pixels, drawn.primitives};
+
+        if (options.mode == "images") {
+            if (!checkImage(options, name)) failed++;
+        } else if (options.mode == "costs") {
+            if (!checkCost(options, name, cost, costs)) failed++;
+        } else {
+            std::string path = options.golden + "/" + name + ".png";
+            if (!writePng(path.c_str(), &simGram[0][0], SIM_WIDTH, SIM_HEIGHT)) {
+                fprintf(stderr, "golden: cannot write %s\n", path.c_str());
+                failed++;
+            }
+            fprintf(costsOut, "%-18s %6u %5u\n", name, cost.pixels, cost.primitives);
+            printf("  %-18s %6u px  %5u draws\n", name, cost.pixels, cost.primitives);
+        }
+    }
+    if (costsOut) fclose(costsOut);
+
+    printf("golden %s: %d of %d screens %s\n", options.mode.c_str(), count - failed, count,
+           options.mode == "update" ? "written" : "passed");
+    return failed ? 1 : 0;
+}
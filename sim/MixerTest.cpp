@@ -0,0 +1,144 @@
+// MixerTest.cpp - Host checks for the sound effect mixer (include/AudioMixer.h)
+//
+// Renders effects built for the purpose and checks the samples: silence
+// when idle, the headroom and clipping when voices pile up, the per-note
+// decay, and how voices are freed, reused and stolen. No firmware needed -
+// the mixer is header-only.
+//
+//   cyd-mixer-test        prints each check, exits 1 if any failed
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "AudioMixer.h"
+
+#define TEST_RATE 16000
+#define TEST_HZ 500                 // 32 samples a cycle at TEST_RATE
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok) failures++;
+}
+
+static std::vector<int16_t> render(AudioMixer& mixer, uint32_t ms) {
+    std::vector<int16_t> out(ms * TEST_RATE / 1000);
+    mixer.render(out.data(), out.size());
+    return out;
+}
+
+static int peak(const std::vector<int16_t>& samples, size_t from, size_t to) {
+    int most = 0;
+    for (size_t i = from; i < to && i < samples.size(); i++) {
+        most = std::max(most, abs((int)samples[i]));
+    }
+    return most;
+}
+
+// One long note each: loud square, and a rest that only holds a voice
+static const SfxNote squareNotes[] = {{TEST_HZ, 1000, WAVE_SQUARE, 255}};
+static const SfxNote restNotes[] = {{0, 1000, WAVE_SQUARE, 255}};
+static const SfxNote blipNotes[] = {{TEST_HZ, 10, WAVE_SQUARE, 255}};
+static const SfxNote sawNotes[] = {{TEST_HZ, 20, WAVE_SAW, 255}, {TEST_HZ * 2, 20, WAVE_TRIANGLE, 255}};
+static const Sfx square = {squareNotes, 1};
+static const Sfx rest = {restNotes, 1};
+static const Sfx blip = {blipNotes, 1};
+static const Sfx saw = {sawNotes, 2};
+
+static void testIdle() {
+    AudioMixer mixer(TEST_RATE);
+    std::vector<int16_t> out = render(mixer, 10);
+    check(mixer.activeVoices() == 0 && peak(out, 0, out.size()) == 0, "idle mixer renders silence");
+
+    mixer.play(nullptr);
+    check(mixer.activeVoices() == 0, "a null effect takes no voice");
+}
+
+static void testHeadroom() {
+    AudioMixer mixer(TEST_RATE);
+    mixer.play(&square);
+    std::vector<int16_t> out = render(mixer, 20);
+
+    // Full volume at the start of the note, halved for headroom
+    int first = peak(out, 0, 32);
+    check(first > 16000 && first <= 16384, "one full-volume voice peaks at half scale");
+    check(peak(out, out.size() - 32, out.size()) < first, "the note decays");
+}
+
+static void testClipping() {
+    AudioMixer mixer(TEST_RATE);
+    for (int i = 0; i < MIXER_VOICES; i++) mixer.play(&square);
+    std::vector<int16_t> out = render(mixer, 2);
+
+    // Four voices in phase sum to twice full scale: the top and bottom of
+    // the square sit at the rails, and no sample wraps to the other sign
+    bool clipped = true, wrapped = false;
+    for (size_t i = 0; i < 32; i++) {
+        bool high = i >= 16;
+        int16_t want = high ? INT16_MAX : INT16_MIN;
+        if (out[i] != want) clipped = false;
+        if (high ? out[i] < 0 : out[i] > 0) wrapped = true;
+    }
+    check(clipped, "four loud voices clip at the rails");
+    check(!wrapped, "clipped samples keep their sign");
+
+    // Two voices fit the headroom: near full scale but never at the rails
+    AudioMixer two(TEST_RATE);
+    two.play(&saw);
+    two.play(&saw);
+    out = render(two, 50);
+    bool railed = false;
+    for (int16_t sample : out) railed |= sample == INT16_MAX || sample == INT16_MIN;
+    check(peak(out, 0, out.size()) > 30000 && !railed, "two loud voices fit without clipping");
+    check(two.activeVoices() == 0, "a two-note effect ends after both notes");
+}
+
+static void testReuse() {
+    AudioMixer mixer(TEST_RATE);
+    mixer.play(&blip);
+    check(mixer.activeVoices() == 1, "a playing effect holds a voice");
+    std::vector<int16_t> out = render(mixer, 20);
+    check(mixer.activeVoices() == 0, "a finished effect frees its voice");
+    check(peak(out, 10 * TEST_RATE / 1000, out.size()) == 0, "and is silent after its note");
+
+    // Freed voices are taken again before anything is stolen
+    for (int i = 0; i < MIXER_VOICES; i++) mixer.play(&rest);
+    check(mixer.activeVoices() == MIXER_VOICES, "every voice can be reused");
+
+    mixer.stopAll();
+    check(mixer.activeVoices() == 0, "stopAll frees every voice");
+}
+
+static void testStealing() {
+    // The only sound is on the second voice; the fifth effect takes the
+    // oldest (a rest), the sixth takes the next oldest (the square)
+    AudioMixer mixer(TEST_RATE);
+    mixer.play(&rest);
+    mixer.play(&square);
+    mixer.play(&rest);
+    mixer.play(&rest);
+
+    mixer.play(&rest);
+    std::vector<int16_t> out = render(mixer, 2);
+    check(mixer.activeVoices() == MIXER_VOICES, "a fifth effect steals rather than adds");
+    check(peak(out, 0, out.size()) > 16000, "the oldest voice is stolen first");
+
+    mixer.play(&rest);
+    out = render(mixer, 2);
+    check(peak(out, 0, out.size()) == 0, "then the next oldest");
+}
+
+int main() {
+    printf("audio mixer:\n");
+    testIdle();
+    testHeadroom();
+    testClipping();
+    testReuse();
+    testStealing();
+    printf("audio mixer: %s\n", failures ? "FAILED" : "all passed");
+    return failures ? 1 : 0;
+}
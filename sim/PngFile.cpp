@@ -0,0 +1,160 @@
+// PngFile.cpp - Screens saved as, and read back from, 8-bit PNG files
+
+#include "PngFile.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include <zlib.h>
+
+static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+static void put32(std::vector<uint8_t>& out, uint32_t v) {
+    out.push_back(v >> 24);
+    out.push_back(v >> 16);
+    out.push_back(v >> 8);
+    out.push_back(v);
+}
+
+static void putChunk(FILE* f, const char* type, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> chunk;
+    put32(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    put32(chunk, crc32(0, chunk.data() + 4, chunk.size() - 4));
+    fwrite(chunk.data(), 1, chunk.size(), f);
+}
+
+// 5 and 6 bit channels widened so white stays 255
+static void expand565(uint16_t c, uint8_t* rgb) {
+    uint8_t r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+bool writePng(const char* path, const uint16_t* pixels, int width, int height) {
+    // Each row: filter byte 0 (none), then RGB triples
+    size_t stride = 1 + (size_t)width * 3;
+    std::vector<uint8_t> raw(stride * height);
+    for (int y = 0; y < height; y++) {
+        uint8_t* row = &raw[y * stride];
+        row[0] = 0;
+        for (int x = 0; x < width; x++) expand565(pixels[y * width + x], row + 1 + x * 3);
+    }
+
+    uLongf packedSize = compressBound(raw.size());
+    std::vector<uint8_t> packed(packedSize);
+    if (compress2(packed.data(), &packedSize, raw.data(), raw.size(), 9) != Z_OK) return false;
+    packed.resize(packedSize);
+
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    fwrite(signature, 1, sizeof(signature), f);
+
+    std::vector<uint8_t> header;
+    put32(header, width);
+    put32(header, height);
+    header.push_back(8);    // Bits per channel
+    header.push_back(2);    // RGB
+    header.push_back(0);    // Deflate
+    header.push_back(0);    // Adaptive filtering
+    header.push_back(0);    // Not interlaced
+    putChunk(f, "IHDR", header);
+    putChunk(f, "IDAT", packed);
+    putChunk(f, "IEND", {});
+    return fclose(f) == 0;
+}
+
+static uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static uint8_t paeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+// Undoes the per-row filters in place; bpp is bytes per pixel
+static bool unfilter(std::vector<uint8_t>& raw, int width, int height, int bpp) {
+    size_t stride = 1 + (size_t)width * bpp;
+    for (int y = 0; y < height; y++) {
+        uint8_t* row = &raw[y * stride + 1];
+        const uint8_t* prev = y > 0 ? &raw[(y - 1) * stride + 1] : nullptr;
+        uint8_t filter = row[-1];
+        for (size_t i = 0; i < stride - 1; i++) {
+            int a = i >= (size_t)bpp ? row[i - bpp] : 0;
+            int b = prev ? prev[i] : 0;
+            int c = prev && i >= (size_t)bpp ? prev[i - bpp] : 0;
+            switch (filter) {
+                case 0: break;
+                case 1: row[i] += a; break;
+                case 2: row[i] += b; break;
+                case 3: row[i] += (a + b) / 2; break;
+                case 4: row[i] += paeth(a, b, c); break;
+                default: return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool readPng(const char* path, std::vector<uint16_t>& pixels, int& width, int& height) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    std::vector<uint8_t> file;
+    uint8_t buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) file.insert(file.end(), buffer, buffer + n);
+    fclose(f);
+
+    if (file.size() < 8 || memcmp(file.data(), signature, 8) != 0) return false;
+
+    int bpp = 0;
+    std::vector<uint8_t> packed;
+    for (size_t pos = 8; pos + 12 <= file.size();) {
+        uint32_t len = get32(&file[pos]);
+        const char* type = (const char*)&file[pos + 4];
+        const uint8_t* data = &file[pos + 8];
+        if (pos + 12 + len > file.size()) return false;
+
+        if (memcmp(type, "IHDR", 4) == 0 && len >= 13) {
+            width = get32(data);
+            height = get32(data + 4);
+            if (data[8] != 8 || data[12] != 0) return false;     // 8 bits, not interlaced
+            if (data[9] == 2) bpp = 3;
+            else if (data[9] == 6) bpp = 4;
+            else return false;
+        } else if (memcmp(type, "IDAT", 4) == 0) {
+            packed.insert(packed.end(), data, data + len);
+        } else if (memcmp(type, "IEND", 4) == 0) {
+            break;
+        }
+        pos += 12 + len;
+    }
+    if (bpp == 0 || width <= 0 || height <= 0) return false;
+
+    std::vector<uint8_t> raw((1 + (size_t)width * bpp) * height);
+    uLongf rawSize = raw.size();
+    if (uncompress(raw.data(), &rawSize, packed.data(), packed.size()) != Z_OK ||
+        rawSize != raw.size()) {
+        return false;
+    }
+    if (!unfilter(raw, width, height, bpp)) return false;
+
+    pixels.resize((size_t)width * height);
+    size_t stride = 1 + (size_t)width * bpp;
+    for (int y = 0; y < height; y++) {
+        const uint8_t* row = &raw[y * stride + 1];
+        for (int x = 0; x < width; x++) {
+            const uint8_t* rgb = row + x * bpp;
+            pixels[y * width + x] = (rgb[0] >> 3) << 11 | (rgb[1] >> 2) << 5 | rgb[2] >> 3;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,15 @@
+// PngFile.h - Screens saved as, and read back from, 8-bit PNG files (zlib
+// does the deflate)
+
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+// RGB565 pixels in natural byte order, row by row
+bool writePng(const char* path, const uint16_t* pixels, int width, int height);
+
+// 8-bit RGB or RGBA, not interlaced - what writePng() and most tools that
+// re-save it produce. Pixels come back as RGB565; alpha is ignored.
+bool readPng(const char* path, std::vector<uint16_t>& pixels, int& width, int& height);
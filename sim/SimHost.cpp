@@ -0,0 +1,257 @@
+// SimHost.cpp - Clock, console and the Arduino/ESP-IDF calls the firmware makes
+
+#include "SimHost.h"
+
+#include <Arduino.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <driver/gpio.h>
+#include <driver/i2s.h>
+#include <driver/ledc.h>
+#include <driver/uart.h>
+
+#include <chrono>
+#include <deque>
+#include <random>
+#include <thread>
+
+#ifndef SPI_FREQUENCY
+#define SPI_FREQUENCY 40000000
+#endif
+
+uint16_t simGram[SIM_HEIGHT][SIM_WIDTH];
+SimPanelCounters simPanelCounters;
+uint64_t simBusBytes = 0;
+uint8_t simBacklight = 0;
+uint32_t simSeed = 0;
+const char* simNvsPath = nullptr;
+bool (*simWaitForInput)(int64_t hostUs) = nullptr;
+int64_t simHostWaitedUs = 0;
+
+SimPanelCounters simTakeCounters() {
+    SimPanelCounters taken = simPanelCounters;
+    simPanelCounters = SimPanelCounters{};
+    return taken;
+}
+
+// ============================================================================
+// CLOCK
+// ============================================================================
+
+static bool clockFast = true;
+static double clockSpeed = 1.0;
+static int64_t virtualUs = 0;       // Fast clock only
+static std::chrono::steady_clock::time_point hostStart = std::chrono::steady_clock::now();
+
+static int64_t hostElapsedUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - hostStart).count();
+}
+
+void simClockBegin(bool fast, double speed) {
+    clockFast = fast;
+    clockSpeed = speed > 0 ? speed : 1.0;
+    virtualUs = 0;
+    hostStart = std::chrono::steady_clock::now();
+}
+
+int64_t simNowUs() {
+    if (clockFast) return virtualUs + (int64_t)(simBusBytes * 8 * 1000000 / SPI_FREQUENCY);
+    return (int64_t)(hostElapsedUs() * clockSpeed);
+}
+
+static bool hostWait(int64_t hostUs) {
+    if (hostUs <= 0) return false;
+    int64_t start = hostElapsedUs();
+    bool input = false;
+    if (simWaitForInput) {
+        input = simWaitForInput(hostUs);
+    } else {
+        std::this_thread::sleep_for(std::chrono::microseconds(hostUs));
+    }
+    simHostWaitedUs += hostElapsedUs() - start;
+    return input;
+}
+
+void simWaitUs(int64_t us) {
+    if (us <= 0) return;
+    if (clockFast) {
+        virtualUs += us;
+        return;
+    }
+    int64_t start = hostElapsedUs();
+    std::this_thread::sleep_for(std::chrono::microseconds((int64_t)(us / clockSpeed)));
+    simHostWaitedUs += hostElapsedUs() - start;
+}
+
+bool simSleepUs(int64_t us) {
+    if (us <= 0) return false;
+    if (clockFast) {
+        // Input only ever arrives between passes, so sleeps always run out
+        virtualUs += us;
+        return false;
+    }
+    return hostWait((int64_t)(us / clockSpeed));
+}
+
+void simLoopDone() {
+    if (clockFast) virtualUs += SIM_LOOP_US;
+}
+
+// ============================================================================
+// CONSOLE
+// ============================================================================
+
+static std::deque<char> serialInput;
+
+void simSerialType(const char* line) {
+    while (*line) serialInput.push_back(*line++);
+    serialInput.push_back('\n');
+}
+
+bool simSerialPending() {
+    return !serialInput.empty();
+}
+
+HardwareSerial Serial;
+bool simSerialMuted = false;
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (c != '\r' && !simSerialMuted) fputc(c, stdout);
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    for (size_t i = 0; i < size; i++) write(buffer[i]);
+    return size;
+}
+
+int HardwareSerial::available() {
+    return (int)serialInput.size();
+}
+
+int HardwareSerial::read() {
+    if (serialInput.empty()) return -1;
+    char c = serialInput.front();
+    serialInput.pop_front();
+    return (uint8_t)c;
+}
+
+void HardwareSerial::flush() {
+    fflush(stdout);
+}
+
+// ============================================================================
+// ARDUINO CORE
+// ============================================================================
+
+static uint32_t cpuMhz = 240;
+EspClass ESP;
+
+unsigned long millis() { return (unsigned long)(simNowUs() / 1000); }
+unsigned long micros() { return (unsigned long)simNowUs(); }
+void delay(unsigned long ms) { simWaitUs((int64_t)ms * 1000); }
+void delayMicroseconds(unsigned int us) { simWaitUs(us); }
+void yield() {}
+
+int64_t esp_timer_get_time() { return simNowUs(); }
+
+// At the clock the firmware asked for, from the simulated time
+uint32_t EspClass::getCycleCount() { return (uint32_t)(simNowUs() * cpuMhz); }
+
+bool setCpuFrequencyMhz(uint32_t mhz) {
+    cpuMhz = mhz;
+    return true;
+}
+
+uint32_t getCpuFrequencyMhz() { return cpuMhz; }
+
+static std::mt19937 hostRandom(std::random_device{}());
+
+uint32_t esp_random() {
+    return simSeed ? simSeed : (uint32_t)hostRandom();
+}
+
+long random(long hi) { return hi > 0 ? (long)(hostRandom() % (uint32_t)hi) : 0; }
+long random(long lo, long hi) { return hi > lo ? lo + random(hi - lo) : lo; }
+void randomSeed(unsigned long seed) { hostRandom.seed(seed); }
+
+long map(long x, long inLo, long inHi, long outLo, long outHi) {
+    return (x - inLo) * (outHi - outLo) / (inHi - inLo) + outLo;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+void digitalWrite(uint8_t pin, uint8_t value) {}
+int digitalRead(uint8_t pin) { return HIGH; }
+uint16_t analogRead(uint8_t pin) { return 0; }
+
+// ============================================================================
+// ESP-IDF
+// ============================================================================
+
+static int64_t sleepTimerUs = 0;
+static esp_sleep_wakeup_cause_t wakeCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us) {
+    sleepTimerUs = (int64_t)us;
+    return ESP_OK;
+}
+
+esp_err_t esp_light_sleep_start() {
+    bool input = simSleepUs(sleepTimerUs);
+    if (!input) {
+        wakeCause = ESP_SLEEP_WAKEUP_TIMER;
+    } else {
+        wakeCause = simSerialPending() ? ESP_SLEEP_WAKEUP_UART : ESP_SLEEP_WAKEUP_GPIO;
+    }
+    return ESP_OK;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() { return wakeCause; }
+esp_err_t esp_sleep_enable_gpio_wakeup() { return ESP_OK; }
+esp_err_t esp_sleep_enable_uart_wakeup(int uart) { return ESP_OK; }
+esp_err_t esp_sleep_pd_config(esp_sleep_pd_domain_t domain, esp_sleep_pd_option_t option) { return ESP_OK; }
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type) { return ESP_OK; }
+esp_err_t uart_set_wakeup_threshold(uart_port_t uart, int edges) { return ESP_OK; }
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t* config) { return ESP_OK; }
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t* config) {
+    simBacklight = (uint8_t)config->duty;
+    return ESP_OK;
+}
+
+esp_err_t ledc_fade_func_install(int flags) { return ESP_OK; }
+
+esp_err_t ledc_set_fade_with_time(ledc_mode_t mode, ledc_channel_t channel, uint32_t duty, int ms) {
+    simBacklight = (uint8_t)duty;
+    return ESP_OK;
+}
+
+esp_err_t ledc_fade_start(ledc_mode_t mode, ledc_channel_t channel, ledc_fade_mode_t wait) { return ESP_OK; }
+
+esp_err_t ledc_set_duty(ledc_mode_t mode, ledc_channel_t channel, uint32_t duty) {
+    simBacklight = (uint8_t)duty;
+    return ESP_OK;
+}
+
+esp_err_t ledc_update_duty(ledc_mode_t mode, ledc_channel_t channel) { return ESP_OK; }
+
+// The sound task is never started - soundQueue stays null and playSfx()
+// returns before queueing anything
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) { return nullptr; }
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait) { return pdFALSE; }
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait) { return pdFALSE; }
+
+BaseType_t xTaskCreatePinnedToCore(void (*task)(void*), const char* name, uint32_t stack,
+                                   void* arg, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core) {
+    return pdFALSE;
+}
+
+esp_err_t i2s_driver_install(i2s_port_t port, const i2s_config_t* config, int queueSize, void* queue) { return ESP_FAIL; }
+esp_err_t i2s_set_pin(i2s_port_t port, const i2s_pin_config_t* pins) { return ESP_OK; }
+esp_err_t i2s_set_dac_mode(i2s_dac_mode_t mode) { return ESP_OK; }
+esp_err_t i2s_write(i2s_port_t port, const void* data, size_t size, size_t* written, uint32_t ticks) { return ESP_FAIL; }
+esp_err_t i2s_start(i2s_port_t port) { return ESP_OK; }
+esp_err_t i2s_stop(i2s_port_t port) { return ESP_OK; }
@@ -0,0 +1,80 @@
+// SimHost.h - What the firmware shims share with the simulator front end
+//
+// The panel's pixels, the clock, the serial console and the backlight live
+// here. The front end (SimMain.cpp) reads the panel and counters after each
+// loop() pass, feeds console input, and decides how time passes:
+//
+//   real time   esp_timer_get_time() follows the host clock times `speed`;
+//               delays and light sleeps wait for real (divided by speed)
+//   fast        a virtual clock that only moves when the firmware delays,
+//               sleeps, finishes a loop() pass, or sends the panel data (at
+//               SPI_FREQUENCY) - runs as fast as the host can and repeats
+//               exactly from the same seed and input
+
+#pragma once
+
+#include <stdint.h>
+
+#define SIM_WIDTH 320
+#define SIM_HEIGHT 240
+#define SIM_LOOP_US 500             // Fast clock: what one loop() pass costs
+#define SIM_WINDOW_BYTES 11         // CASET + RASET + RAMWR per primitive
+
+// The panel's GRAM, RGB565 in natural (not wire) byte order
+extern uint16_t simGram[SIM_HEIGHT][SIM_WIDTH];
+
+// Since the last simTakeCounters()
+struct SimPanelCounters {
+    uint32_t pixels;                // Written to GRAM
+    uint32_t primitives;            // Leaf draw calls and pushed windows
+};
+extern SimPanelCounters simPanelCounters;
+SimPanelCounters simTakeCounters();
+
+// Everything sent to the panel since boot, for the fast clock
+extern uint64_t simBusBytes;
+
+// The panel shim reports each write through these
+inline void simPanelPrimitive() {
+    simPanelCounters.primitives++;
+    simBusBytes += SIM_WINDOW_BYTES;
+}
+
+inline void simPanelPixels(uint32_t pixels) {
+    simPanelCounters.pixels += pixels;
+    simBusBytes += 2 * pixels;
+}
+
+extern uint8_t simBacklight;        // Backlight PWM duty, 0-255
+
+// ---- Clock ----
+
+void simClockBegin(bool fast, double speed);
+int64_t simNowUs();
+// Time passes without the firmware running (delay)
+void simWaitUs(int64_t us);
+// Light sleep: returns early, true, if input arrived before `us` was up
+bool simSleepUs(int64_t us);
+// Fast clock: account one loop() pass
+void simLoopDone();
+
+// Host time spent waiting in delays and sleeps, so the front end can take
+// it out of a pass's frame time
+extern int64_t simHostWaitedUs;
+
+// Set by the front end: wait up to hostUs of host time, returning true as
+// soon as there is input that should wake the board. Null just sleeps.
+extern bool (*simWaitForInput)(int64_t hostUs);
+
+// ---- Console ----
+
+// Typed on the serial console, one line at a time
+void simSerialType(const char* line);
+bool simSerialPending();
+// Drops the firmware's output instead of printing it
+extern bool simSerialMuted;
+
+// ---- Run settings ----
+
+extern uint32_t simSeed;            // esp_random()'s value, 0 = host random
+extern const char* simNvsPath;      // Preferences backing file, null = memory only
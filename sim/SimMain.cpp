@@ -0,0 +1,449 @@
+// SimMain.cpp - The firmware's setup()/loop() on the desktop
+//
+// Runs src/*.cpp unchanged against the shims in sim/shim, shows the panel
+// in an SDL2 window (scaled, dimmed by the backlight PWM) and turns the
+// left mouse button into touches through the firmware's scripted-touch
+// path - the same one the serial 'tap' and 'swipe' commands use, so the
+// gesture recognizer sees a mouse drag just like a finger.
+//
+// A bar along the bottom shows the last drawn frame: host time spent in
+// loop() and the pixels and primitives it pushed to the panel. O toggles
+// it, P saves a screenshot, Esc quits.
+//
+// --headless runs without a window (SDL's dummy video driver when built
+// with SDL2) on the fast clock, for scripts and CI:
+//
+//   cyd-sim --headless --seed 1 --script round.txt --shot end.png
+//
+// Script lines (# starts a comment) are typed on the serial console one
+// per loop() pass, except:
+//   sleep MS                let the firmware run for MS simulated ms
+//   png FILE                save the screen as a PNG (the firmware's own
+//                           'shot' prints it on the console instead)
+//   quit
+//
+// Console input typed in the terminal reaches the firmware too.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if SIM_SDL
+#include <SDL.h>
+#endif
+
+#include "PngFile.h"
+#include "SimHost.h"
+#include "shim/GlcdFont.h"
+
+// From src/main.cpp
+void setup();
+void loop();
+void pressScriptedTouch(int x, int y);
+void moveScriptedTouch(int x, int y);
+void releaseScriptedTouch();
+
+#define OVERLAY_H 10                // Bar height in panel pixels
+#define PRESENT_EVERY_US 16000      // Window refresh cap (host time)
+
+struct Options {
+    bool headless = false;
+    bool fast = false;              // Set by --fast, or by --headless without --speed
+    double speed = 1.0;
+    bool speedGiven = false;
+    int scale = 2;
+    const char* script = nullptr;
+    const char* shot = nullptr;
+    int64_t runMs = 0;
+};
+
+// Passes that pushed pixels, measured in host time with the waiting taken out
+struct FrameStats {
+    uint32_t frames;
+    int64_t totalUs, worstUs, lastUs;
+    uint64_t totalPixels;
+    uint32_t worstPixels, lastPixels, lastPrimitives;
+
+    void add(int64_t us, const SimPanelCounters& c) {
+        frames++;
+        totalUs += us;
+        if (us > worstUs) worstUs = us;
+        totalPixels += c.pixels;
+        if (c.pixels > worstPixels) worstPixels = c.pixels;
+        lastUs = us;
+        lastPixels = c.pixels;
+        lastPrimitives = c.primitives;
+    }
+};
+
+static FrameStats stats = {};
+static bool running = true;
+
+// ============================================================================
+// SCRIPT AND CONSOLE
+// ============================================================================
+
+static std::vector<std::string> scriptLines;
+static size_t scriptNext = 0;
+static int64_t scriptResumeUs = 0;
+static bool stdinOpen = true;
+static std::string stdinLine;
+
+static void saveShot(const char* path) {
+    if (writePng(path, &simGram[0][0], SIM_WIDTH, SIM_HEIGHT)) {
+        fprintf(stderr, "sim: saved %s\n", path);
+    } else {
+        fprintf(stderr, "sim: could not write %s\n", path);
+    }
+}
+
+static bool scriptDone() {
+    return scriptNext >= scriptLines.size() && simNowUs() >= scriptResumeUs;
+}
+
+// At most one console line per pass, so each command runs before the next
+static void stepScript() {
+    while (scriptNext < scriptLines.size() && simNowUs() >= scriptResumeUs && !simSerialPending()) {
+        std::string line = scriptLines[scriptNext++];
+        line = line.substr(0, line.find('#'));
+        line.erase(0, line.find_first_not_of(" \t"));
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+        if (line.empty()) continue;
+
+        if (line.compare(0, 6, "sleep ") == 0) {
+            scriptResumeUs = simNowUs() + atoll(line.c_str() + 6) * 1000;
+        } else if (line.compare(0, 4, "png ") == 0) {
+            saveShot(line.c_str() + 4);
+        } else if (line == "quit") {
+            running = false;
+        } else {
+            simSerialType(line.c_str());
+            return;
+        }
+    }
+}
+
+static bool stdinReady(int timeoutMs) {
+    if (!stdinOpen) return false;
+    struct pollfd fd = {STDIN_FILENO, POLLIN, 0};
+    return poll(&fd, 1, timeoutMs) > 0;
+}
+
+static void readConsole() {
+    while (stdinReady(0)) {
+        char buffer[256];
+        ssize_t n = read(STDIN_FILENO, buffer, sizeof(buffer));
+        if (n <= 0) {
+            stdinOpen = false;
+            return;
+        }
+        for (ssize_t i = 0; i < n; i++) {
+            if (buffer[i] == '\n') {
+                simSerialType(stdinLine.c_str());
+                stdinLine.clear();
+            } else {
+                stdinLine += buffer[i];
+            }
+        }
+    }
+}
+
+// ============================================================================
+// WINDOW
+// ============================================================================
+
+#if SIM_SDL
+
+// The panel's pixels dimmed by the backlight, as ARGB8888
+static void composeScreen(uint32_t* out) {
+    uint32_t level = simBacklight;
+    for (int y = 0; y < SIM_HEIGHT; y++) {
+        for (int x = 0; x < SIM_WIDTH; x++) {
+            uint16_t c = simGram[y][x];
+            uint32_t r = ((c >> 11) * 527 + 23) >> 6;
+            uint32_t g = (((c >> 5) & 0x3F) * 259 + 33) >> 6;
+            uint32_t b = ((c & 0x1F) * 527 + 23) >> 6;
+            r = r * level / 255;
+            g = g * level / 255;
+            b = b * level / 255;
+            *out++ = 0xFF000000 | (r << 16) | (g << 8) | b;
+        }
+    }
+}
+
+static void overlayText(uint32_t* screen, int x, int y, const char* text, uint32_t color) {
+    for (; *text; text++, x += 6) {
+        for (int col = 0; col < 5; col++) {
+            uint8_t bits = glcdColumn((uint8_t)*text, col);
+            for (int row = 0; row < 8; row++) {
+                int px = x + col, py = y + row;
+                if ((bits >> row) & 1 && px < SIM_WIDTH && py < SIM_HEIGHT) {
+                    screen[py * SIM_WIDTH + px] = color;
+                }
+            }
+        }
+    }
+}
+
+// Darkens the bottom strip and writes the last frame's numbers over it
+static void drawOverlay(uint32_t* screen) {
+    for (int y = SIM_HEIGHT - OVERLAY_H; y < SIM_HEIGHT; y++) {
+        for (int x = 0; x < SIM_WIDTH; x++) {
+            uint32_t& p = screen[y * SIM_WIDTH + x];
+            p = 0xFF000000 | ((p >> 2) & 0x003F3F3F);
+        }
+    }
+    char text[64];
+    snprintf(text, sizeof(text), "%6.2f ms %6u px %4u prims  %7.1f s",
+             stats.lastUs / 1000.0, stats.lastPixels, stats.lastPrimitives, simNowUs() / 1e6);
+    overlayText(screen, 2, SIM_HEIGHT - OVERLAY_H + 1, text, 0xFFFFE000);
+}
+
+struct Window {
+    SDL_Window* window = nullptr;
+    SDL_Renderer* renderer = nullptr;
+    SDL_Texture* texture = nullptr;
+    std::vector<uint32_t> pixels;
+    bool overlay = true;
+    bool mouseDown = false;
+    int shots = 0;
+    std::chrono::steady_clock::time_point lastPresent;
+};
+
+static Window win;
+
+static bool openWindow(const Options& options) {
+    if (options.headless) SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+    if (SDL_Init(SDL_INIT_VIDEO) != 0) {
+        fprintf(stderr, "sim: SDL_Init: %s\n", SDL_GetError());
+        return false;
+    }
+    win.window = SDL_CreateWindow("CYD Math Facts", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
+                                  SIM_WIDTH * options.scale, SIM_HEIGHT * options.scale, 0);
+    if (!win.window) {
+        fprintf(stderr, "sim: SDL_CreateWindow: %s\n", SDL_GetError());
+        return false;
+    }
+    win.renderer = SDL_CreateRenderer(win.window, -1, 0);
+    if (!win.renderer) win.renderer = SDL_CreateRenderer(win.window, -1, SDL_RENDERER_SOFTWARE);
+    if (!win.renderer) {
+        fprintf(stderr, "sim: SDL_CreateRenderer: %s\n", SDL_GetError());
+        return false;
+    }
+    // Mouse positions arrive in panel pixels
+    SDL_RenderSetLogicalSize(win.renderer, SIM_WIDTH, SIM_HEIGHT);
+    win.texture = SDL_CreateTexture(win.renderer, SDL_PIXELFORMAT_ARGB8888,
+                                    SDL_TEXTUREACCESS_STREAMING, SIM_WIDTH, SIM_HEIGHT);
+    win.pixels.resize(SIM_WIDTH * SIM_HEIGHT);
+    return win.texture != nullptr;
+}
+
+static void closeWindow() {
+    if (win.texture) SDL_DestroyTexture(win.texture);
+    if (win.renderer) SDL_DestroyRenderer(win.renderer);
+    if (win.window) SDL_DestroyWindow(win.window);
+    SDL_Quit();
+}
+
+static void presentWindow(bool force) {
+    auto now = std::chrono::steady_clock::now();
+    if (!force && now - win.lastPresent < std::chrono::microseconds(PRESENT_EVERY_US)) return;
+    win.lastPresent = now;
+
+    composeScreen(win.pixels.data());
+    if (win.overlay) drawOverlay(win.pixels.data());
+    SDL_UpdateTexture(win.texture, nullptr, win.pixels.data(), SIM_WIDTH * sizeof(uint32_t));
+    SDL_RenderClear(win.renderer);
+    SDL_RenderCopy(win.renderer, win.texture, nullptr, nullptr);
+    SDL_RenderPresent(win.renderer);
+}
+
+static void handleEvents() {
+    SDL_Event e;
+    while (SDL_PollEvent(&e)) {
+        switch (e.type) {
+        case SDL_QUIT:
+            running = false;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+            if (e.button.button == SDL_BUTTON_LEFT) {
+                win.mouseDown = true;
+                pressScriptedTouch(e.button.x, e.button.y);
+            }
+            break;
+        case SDL_MOUSEMOTION:
+            if (win.mouseDown) moveScriptedTouch(e.motion.x, e.motion.y);
+            break;
+        case SDL_MOUSEBUTTONUP:
+            if (e.button.button == SDL_BUTTON_LEFT && win.mouseDown) {
+                win.mouseDown = false;
+                releaseScriptedTouch();
+            }
+            break;
+        case SDL_KEYDOWN:
+            if (e.key.keysym.sym == SDLK_ESCAPE) {
+                running = false;
+            } else if (e.key.keysym.sym == SDLK_o) {
+                win.overlay = !win.overlay;
+                presentWindow(true);
+            } else if (e.key.keysym.sym == SDLK_p) {
+                char path[32];
+                snprintf(path, sizeof(path), "sim-%03d.png", win.shots++);
+                saveShot(path);
+            }
+            break;
+        }
+    }
+}
+
+// Light sleep on the real-time clock: wake for a press or console input
+static bool waitForInput(int64_t hostUs) {
+    auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(hostUs);
+    while (std::chrono::steady_clock::now() < until) {
+        SDL_PumpEvents();
+        if (SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_QUIT, SDL_QUIT) > 0 ||
+            SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_MOUSEBUTTONDOWN, SDL_MOUSEBUTTONDOWN) > 0 ||
+            SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_KEYDOWN, SDL_KEYDOWN) > 0) {
+            return true;
+        }
+        if (stdinReady(1)) return true;
+    }
+    return false;
+}
+
+#else
+
+static bool waitForInput(int64_t hostUs) {
+    return stdinReady((int)((hostUs + 999) / 1000));
+}
+
+#endif
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+static void usage() {
+    fprintf(stderr,
+            "Usage: cyd-sim [options]\n"
+            "  --headless         no window; fast clock unless --speed is given\n"
+            "  --fast             fast clock: run as quickly as the host can\n"
+            "  --speed X          real-time clock running X times faster (default 1)\n"
+            "  --scale N          window pixels per panel pixel (default 2)\n"
+            "  --script FILE      console commands, 'sleep MS', 'png FILE', 'quit'\n"
+            "  --run-ms N         stop after N simulated ms\n"
+            "  --seed N           esp_random() returns N, so runs repeat\n"
+            "  --nvs FILE         keep Preferences in FILE between runs\n"
+            "  --shot FILE        save the last screen as a PNG on exit\n");
+}
+
+static bool parseArgs(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--headless") {
+            options.headless = true;
+        } else if (arg == "--fast") {
+            options.fast = true;
+        } else if (arg == "--speed" && hasValue) {
+            options.speed = atof(argv[++i]);
+            options.speedGiven = true;
+        } else if (arg == "--scale" && hasValue) {
+            options.scale = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--script" && hasValue) {
+            options.script = argv[++i];
+        } else if (arg == "--run-ms" && hasValue) {
+            options.runMs = atoll(argv[++i]);
+        } else if (arg == "--seed" && hasValue) {
+            simSeed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else if (arg == "--nvs" && hasValue) {
+            simNvsPath = argv[++i];
+        } else if (arg == "--shot" && hasValue) {
+            options.shot = argv[++i];
+        } else {
+            usage();
+            return false;
+        }
+    }
+#if !SIM_SDL
+    if (!options.headless) {
+        fprintf(stderr, "sim: built without SDL2 - running headless\n");
+        options.headless = true;
+    }
+#endif
+    if (options.headless && !options.speedGiven) options.fast = true;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) return 2;
+
+    if (options.script) {
+        std::ifstream file(options.script);
+        if (!file) {
+            fprintf(stderr, "sim: cannot read %s\n", options.script);
+            return 2;
+        }
+        for (std::string line; std::getline(file, line);) scriptLines.push_back(line);
+    }
+
+#if SIM_SDL
+    if (!openWindow(options)) return 1;
+#endif
+    simWaitForInput = waitForInput;
+    simClockBegin(options.fast, options.speed);
+
+    setup();
+    simTakeCounters();
+
+    while (running) {
+#if SIM_SDL
+        handleEvents();
+#endif
+        stepScript();
+        readConsole();
+
+        auto start = std::chrono::steady_clock::now();
+        int64_t waitedBefore = simHostWaitedUs;
+        loop();
+        int64_t us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count() - (simHostWaitedUs - waitedBefore);
+        simLoopDone();
+
+        SimPanelCounters drawn = simTakeCounters();
+        if (drawn.pixels > 0) stats.add(us, drawn);
+#if SIM_SDL
+        presentWindow(false);
+#endif
+
+        if (options.runMs > 0 && simNowUs() >= options.runMs * 1000) break;
+        // Headless runs end with their script, or with the console
+        if (options.headless && options.runMs == 0 && scriptDone() && !simSerialPending() &&
+            (options.script || !stdinOpen)) {
+            break;
+        }
+    }
+    fflush(stdout);
+
+    if (options.shot) saveShot(options.shot);
+    fprintf(stderr, "sim: %u frames drawn in %.1f s simulated, host %.2f ms per frame (worst %.2f), "
+            "%.0f px per frame (worst %u)\n",
+            stats.frames, simNowUs() / 1e6,
+            stats.frames ? stats.totalUs / 1000.0 / stats.frames : 0.0, stats.worstUs / 1000.0,
+            stats.frames ? (double)stats.totalPixels / stats.frames : 0.0, stats.worstPixels);
+
+#if SIM_SDL
+    closeWindow();
+#endif
+    return 0;
+}
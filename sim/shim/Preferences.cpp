@@ -0,0 +1,176 @@
+// Preferences.cpp - In-memory NVS, written through to simNvsPath when set
+//
+// The file is the whole store, rewritten after every change: a list of
+// (namespace, key, length, bytes) records. Values are kept as raw bytes
+// whatever their type, which is all the firmware's round trips need.
+
+#include <Preferences.h>
+#include <nvs.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <map>
+#include <vector>
+
+#include "../SimHost.h"
+
+#define SIM_NVS_ENTRIES 504         // A 20 KB partition: 5 pages of 126, one kept free
+#define SIM_NVS_ENTRY_BYTES 32
+
+typedef std::map<std::string, std::vector<uint8_t>> Namespace;
+static std::map<std::string, Namespace> store;
+static bool storeLoaded = false;
+
+static void loadStore() {
+    storeLoaded = true;
+    if (!simNvsPath) return;
+    FILE* f = fopen(simNvsPath, "rb");
+    if (!f) return;
+
+    uint8_t nsLen, keyLen;
+    uint32_t len;
+    char ns[256], key[256];
+    while (fread(&nsLen, 1, 1, f) == 1 && fread(ns, 1, nsLen, f) == nsLen &&
+           fread(&keyLen, 1, 1, f) == 1 && fread(key, 1, keyLen, f) == keyLen &&
+           fread(&len, sizeof(len), 1, f) == 1) {
+        std::vector<uint8_t> value(len);
+        if (len && fread(value.data(), 1, len, f) != len) break;
+        store[std::string(ns, nsLen)][std::string(key, keyLen)] = value;
+    }
+    fclose(f);
+}
+
+static void saveStore() {
+    if (!simNvsPath) return;
+    FILE* f = fopen(simNvsPath, "wb");
+    if (!f) return;
+    for (const auto& ns : store) {
+        for (const auto& entry : ns.second) {
+            uint8_t nsLen = ns.first.size(), keyLen = entry.first.size();
+            uint32_t len = entry.second.size();
+            fwrite(&nsLen, 1, 1, f);
+            fwrite(ns.first.data(), 1, nsLen, f);
+            fwrite(&keyLen, 1, 1, f);
+            fwrite(entry.first.data(), 1, keyLen, f);
+            fwrite(&len, sizeof(len), 1, f);
+            fwrite(entry.second.data(), 1, len, f);
+        }
+    }
+    fclose(f);
+}
+
+// As the real NVS counts them: a number is one entry, a blob an index
+// entry, a header entry and its data in 32-byte entries
+static size_t entriesFor(size_t len) {
+    if (len <= 8) return 1;
+    return 2 + (len + SIM_NVS_ENTRY_BYTES - 1) / SIM_NVS_ENTRY_BYTES;
+}
+
+static size_t usedEntries() {
+    size_t used = 0;
+    for (const auto& ns : store) {
+        if (ns.second.empty()) continue;
+        used++;
+        for (const auto& entry : ns.second) used += entriesFor(entry.second.size());
+    }
+    return used;
+}
+
+esp_err_t nvs_get_stats(const char* part_name, nvs_stats_t* stats) {
+    if (!storeLoaded) loadStore();
+    stats->used_entries = usedEntries();
+    stats->total_entries = SIM_NVS_ENTRIES;
+    stats->free_entries = SIM_NVS_ENTRIES - stats->used_entries;
+    stats->namespace_count = store.size();
+    return ESP_OK;
+}
+
+// ---- Preferences ----
+
+bool Preferences::begin(const char* name, bool readOnly, const char* partition) {
+    if (!storeLoaded) loadStore();
+    ns = name;
+    open = true;
+    this->readOnly = readOnly;
+    return true;
+}
+
+void Preferences::end() {
+    open = false;
+}
+
+bool Preferences::clear() {
+    if (!open || readOnly) return false;
+    store.erase(ns);
+    saveStore();
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!open || readOnly) return false;
+    bool removed = store[ns].erase(key) > 0;
+    saveStore();
+    return removed;
+}
+
+bool Preferences::isKey(const char* key) {
+    return open && store[ns].count(key) > 0;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+    if (!open || readOnly) return 0;
+    // A full partition refuses the write and keeps the old value
+    auto& entries = store[ns];
+    auto old = entries.find(key);
+    size_t freed = old != entries.end() ? entriesFor(old->second.size()) : 0;
+    if (usedEntries() - freed + entriesFor(len) > SIM_NVS_ENTRIES) return 0;
+    const uint8_t* bytes = (const uint8_t*)value;
+    entries[key] = std::vector<uint8_t>(bytes, bytes + len);
+    saveStore();
+    return len;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    if (!isKey(key)) return 0;
+    return store[ns][key].size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t maxLen) {
+    size_t len = getBytesLength(key);
+    if (len == 0 || len > maxLen) return 0;
+    memcpy(buffer, store[ns][key].data(), len);
+    return len;
+}
+
+template <class T>
+T Preferences::getValue(const char* key, T fallback) {
+    T value;
+    return getBytes(key, &value, sizeof(value)) == sizeof(value) ? value : fallback;
+}
+
+size_t Preferences::putInt(const char* key, int32_t value) { return putBytes(key, &value, sizeof(value)); }
+int32_t Preferences::getInt(const char* key, int32_t fallback) { return getValue(key, fallback); }
+size_t Preferences::putUInt(const char* key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+uint32_t Preferences::getUInt(const char* key, uint32_t fallback) { return getValue(key, fallback); }
+size_t Preferences::putULong(const char* key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+uint32_t Preferences::getULong(const char* key, uint32_t fallback) { return getValue(key, fallback); }
+size_t Preferences::putUShort(const char* key, uint16_t value) { return putBytes(key, &value, sizeof(value)); }
+uint16_t Preferences::getUShort(const char* key, uint16_t fallback) { return getValue(key, fallback); }
+size_t Preferences::putUChar(const char* key, uint8_t value) { return putBytes(key, &value, sizeof(value)); }
+uint8_t Preferences::getUChar(const char* key, uint8_t fallback) { return getValue(key, fallback); }
+size_t Preferences::putBool(const char* key, bool value) { return putBytes(key, &value, sizeof(value)); }
+bool Preferences::getBool(const char* key, bool fallback) { return getValue(key, fallback); }
+
+size_t Preferences::putString(const char* key, const char* value) {
+    return putBytes(key, value, strlen(value) + 1);
+}
+
+size_t Preferences::getString(const char* key, char* value, size_t maxLen) {
+    return getBytes(key, value, maxLen);
+}
+
+size_t Preferences::freeEntries() {
+    if (!storeLoaded) loadStore();
+    return SIM_NVS_ENTRIES - usedEntries();
+}
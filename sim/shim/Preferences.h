@@ -0,0 +1,45 @@
+// Preferences.h - NVS namespaces held in memory, optionally backed by a file
+// (the simulator's --nvs), so profiles and stats survive between runs
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <string>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false, const char* partition = nullptr);
+    void end();
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+
+    size_t putInt(const char* key, int32_t value);
+    int32_t getInt(const char* key, int32_t fallback = 0);
+    size_t putUInt(const char* key, uint32_t value);
+    uint32_t getUInt(const char* key, uint32_t fallback = 0);
+    size_t putULong(const char* key, uint32_t value);
+    uint32_t getULong(const char* key, uint32_t fallback = 0);
+    size_t putUShort(const char* key, uint16_t value);
+    uint16_t getUShort(const char* key, uint16_t fallback = 0);
+    size_t putUChar(const char* key, uint8_t value);
+    uint8_t getUChar(const char* key, uint8_t fallback = 0);
+    size_t putBool(const char* key, bool value);
+    bool getBool(const char* key, bool fallback = false);
+    size_t putString(const char* key, const char* value);
+    size_t getString(const char* key, char* value, size_t maxLen);
+    size_t putBytes(const char* key, const void* value, size_t len);
+    size_t getBytes(const char* key, void* buffer, size_t maxLen);
+    size_t getBytesLength(const char* key);
+    size_t freeEntries();
+
+private:
+    template <class T>
+    T getValue(const char* key, T fallback);
+
+    std::string ns;
+    bool open = false;
+    bool readOnly = false;
+};
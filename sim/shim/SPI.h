@@ -0,0 +1,3 @@
+// SPI.h - Nothing to configure: the simulated panel isn't on a bus
+
+#pragma once
@@ -0,0 +1,453 @@
+// TFT_eSPI.cpp - Software ILI9341 and sprites for the desktop simulator
+//
+// Composite primitives follow TFT_eSPI's own algorithms, so they break down
+// into the same leaf calls (and the same pixels) as on the board.
+
+#include <TFT_eSPI.h>
+
+#include <vector>
+
+#include "GlcdFont.h"
+#include "../SimHost.h"
+
+static inline uint16_t swap16(uint16_t v) {
+    return (uint16_t)((v >> 8) | (v << 8));
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+    : cursor_x(0), cursor_y(0), textcolor(TFT_WHITE), textbgcolor(TFT_WHITE),
+      textsize(1), textdatum(TL_DATUM), textwrapX(true), _width(w), _height(h),
+      rotation(0), swapBytes(false), winX0(0), winY0(0), winX1(0), winY1(0),
+      winX(0), winY(0) {}
+
+void TFT_eSPI::init(uint8_t tc) {
+    // Power-on GRAM is noise on the board; black here
+    memset(simGram, 0, sizeof(simGram));
+}
+
+// ============================================================================
+// PANEL STORAGE
+// ============================================================================
+
+void TFT_eSPI::writeBlock(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    int32_t x0 = max(x, (int32_t)0), x1 = min(x + w, (int32_t)min((int32_t)_width, (int32_t)SIM_WIDTH));
+    int32_t y0 = max(y, (int32_t)0), y1 = min(y + h, (int32_t)min((int32_t)_height, (int32_t)SIM_HEIGHT));
+    if (x0 >= x1 || y0 >= y1) return;
+    for (int32_t row = y0; row < y1; row++) {
+        uint16_t* p = &simGram[row][x0];
+        for (int32_t col = x0; col < x1; col++) *p++ = (uint16_t)color;
+    }
+    simPanelPixels((x1 - x0) * (y1 - y0));
+}
+
+void TFT_eSPI::countPrimitive() {
+    simPanelPrimitive();
+}
+
+// ============================================================================
+// LEAF CALLS
+// ============================================================================
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    countPrimitive();
+    writeBlock(x, y, 1, 1, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    countPrimitive();
+    writeBlock(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+    countPrimitive();
+    writeBlock(x, y, 1, h, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    countPrimitive();
+    writeBlock(x, y, w, h, color);
+}
+
+// Bresenham, one primitive however many runs it takes
+void TFT_eSPI::drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) {
+    countPrimitive();
+    int32_t dx = abs(xe - xs), sx = xs < xe ? 1 : -1;
+    int32_t dy = -abs(ye - ys), sy = ys < ye ? 1 : -1;
+    int32_t err = dx + dy;
+    while (true) {
+        writeBlock(xs, ys, 1, 1, color);
+        if (xs == xe && ys == ye) break;
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            xs += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            ys += sy;
+        }
+    }
+}
+
+// GLCD character, 6 x 8 cells scaled by size. bg == color is transparent.
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+    if (c < GLCD_FIRST) return;
+    if (size == 0) size = 1;
+    countPrimitive();
+    bool fillBg = bg != color;
+    for (int i = 0; i < 6; i++) {
+        uint8_t line = i < 5 ? glcdColumn(c, i) : 0;
+        for (int j = 0; j < 8; j++, line >>= 1) {
+            if (line & 1) {
+                writeBlock(x + i * size, y + j * size, size, size, color);
+            } else if (fillBg) {
+                writeBlock(x + i * size, y + j * size, size, size, bg);
+            }
+        }
+    }
+}
+
+int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font) {
+    drawChar(x, y, uniCode, textcolor, textbgcolor, textsize);
+    return 6 * textsize;
+}
+
+int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y) {
+    return drawChar(uniCode, x, y, 1);
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+    if (c == '\n') {
+        cursor_y += 8 * textsize;
+        cursor_x = 0;
+    } else if (c != '\r') {
+        if (textwrapX && cursor_x + 6 * textsize > width()) {
+            cursor_y += 8 * textsize;
+            cursor_x = 0;
+        }
+        cursor_x += drawChar(c, cursor_x, cursor_y, 1);
+    }
+    return 1;
+}
+
+// ============================================================================
+// COMPOSITE PRIMITIVES
+// ============================================================================
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+    fillRect(0, 0, width(), height(), color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y + 1, h - 2, color);
+    drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+    drawFastHLine(x + r, y, w - r - r, color);
+    drawFastHLine(x + r, y + h - 1, w - r - r, color);
+    drawFastVLine(x, y + r, h - r - r, color);
+    drawFastVLine(x + w - 1, y + r, h - r - r, color);
+    drawCircleHelper(x + r, y + r, r, 1, color);
+    drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+    drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+    drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+    fillRect(x, y + r, w, h - r - r, color);
+    fillCircleHelper(x + r, y + h - r - 1, r, 1, w - r - r - 1, color);
+    fillCircleHelper(x + r, y + r, r, 2, w - r - r - 1, color);
+}
+
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+    if (r <= 0) return;
+    int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+    drawPixel(x0, y0 + r, color);
+    drawPixel(x0, y0 - r, color);
+    drawPixel(x0 + r, y0, color);
+    drawPixel(x0 - r, y0, color);
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        drawPixel(x0 + x, y0 + y, color);
+        drawPixel(x0 - x, y0 + y, color);
+        drawPixel(x0 + x, y0 - y, color);
+        drawPixel(x0 - x, y0 - y, color);
+        drawPixel(x0 + y, y0 + x, color);
+        drawPixel(x0 - y, y0 + x, color);
+        drawPixel(x0 + y, y0 - x, color);
+        drawPixel(x0 - y, y0 - x, color);
+    }
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+    int32_t x = 0, dx = 1, dy = r + r, p = -(r >> 1);
+    drawFastHLine(x0 - r, y0, dy + 1, color);
+    while (x < r) {
+        if (p >= 0) {
+            drawFastHLine(x0 - x, y0 + r, dx, color);
+            drawFastHLine(x0 - x, y0 - r, dx, color);
+            dy -= 2;
+            p -= dy;
+            r--;
+        }
+        dx += 2;
+        p += dx;
+        x++;
+        drawFastHLine(x0 - r, y0 + x, dy + 1, color);
+        drawFastHLine(x0 - r, y0 - x, dy + 1, color);
+    }
+}
+
+void TFT_eSPI::drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, uint32_t color) {
+    if (r <= 0) return;
+    int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0;
+    while (x < r) {
+        if (f >= 0) {
+            r--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        if (corners & 0x4) {
+            drawPixel(x0 + x, y0 + r, color);
+            drawPixel(x0 + r, y0 + x, color);
+        }
+        if (corners & 0x2) {
+            drawPixel(x0 + x, y0 - r, color);
+            drawPixel(x0 + r, y0 - x, color);
+        }
+        if (corners & 0x8) {
+            drawPixel(x0 - r, y0 + x, color);
+            drawPixel(x0 - x, y0 + r, color);
+        }
+        if (corners & 0x1) {
+            drawPixel(x0 - r, y0 - x, color);
+            drawPixel(x0 - x, y0 - r, color);
+        }
+    }
+}
+
+void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, int32_t delta, uint32_t color) {
+    int32_t f = 1 - r, ddF_x = 1, ddF_y = -r - r, y = 0;
+    delta++;
+    while (y < r) {
+        if (f >= 0) {
+            if (corners & 0x1) drawFastHLine(x0 - y, y0 + r, y + y + delta, color);
+            if (corners & 0x2) drawFastHLine(x0 - y, y0 - r, y + y + delta, color);
+            r--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        y++;
+        ddF_x += 2;
+        f += ddF_x;
+        if (corners & 0x1) drawFastHLine(x0 - r, y0 + y, r + r + delta, color);
+        if (corners & 0x2) drawFastHLine(x0 - r, y0 - y, r + r + delta, color);
+    }
+}
+
+// ============================================================================
+// ADDRESS WINDOW AND PUSHES
+// ============================================================================
+
+void TFT_eSPI::setWindow(int32_t xs, int32_t ys, int32_t xe, int32_t ye) {
+    countPrimitive();
+    winX0 = winX = xs;
+    winY0 = winY = ys;
+    winX1 = xe;
+    winY1 = ye;
+}
+
+void TFT_eSPI::setAddrWindow(int32_t xs, int32_t ys, int32_t w, int32_t h) {
+    setWindow(xs, ys, xs + w - 1, ys + h - 1);
+}
+
+// Next pixel of the window, wrapping to its next row like the ILI9341
+void TFT_eSPI::pushWindowPixel(uint16_t color) {
+    if (winX >= 0 && winX < SIM_WIDTH && winY >= 0 && winY < SIM_HEIGHT && winY <= winY1) {
+        simGram[winY][winX] = color;
+        simPanelPixels(1);
+    }
+    if (++winX > winX1) {
+        winX = winX0;
+        if (++winY > winY1) winY = winY0;
+    }
+}
+
+void TFT_eSPI::pushColor(uint16_t color) {
+    pushWindowPixel(color);
+}
+
+void TFT_eSPI::pushColor(uint16_t color, uint32_t len) {
+    while (len--) pushWindowPixel(color);
+}
+
+void TFT_eSPI::pushBlock(uint16_t color, uint32_t len) {
+    while (len--) pushWindowPixel(color);
+}
+
+// swap: the data is in natural byte order and goes out swapped
+void TFT_eSPI::pushColors(uint16_t* data, uint32_t len, bool swap) {
+    while (len--) {
+        uint16_t raw = *data++;
+        pushWindowPixel(swap ? raw : swap16(raw));
+    }
+}
+
+// Bytes go out as they sit in memory unless setSwapBytes(true)
+void TFT_eSPI::pushPixels(const void* data, uint32_t len) {
+    const uint16_t* pixels = (const uint16_t*)data;
+    while (len--) {
+        uint16_t raw = *pixels++;
+        pushWindowPixel(swapBytes ? raw : swap16(raw));
+    }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    if (w <= 0 || h <= 0) return;
+    countPrimitive();
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) {
+            uint16_t raw = data[row * w + col];
+            writeBlock(x + col, y + row, 1, 1, swapBytes ? raw : swap16(raw));
+        }
+    }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+    pushImage(x, y, w, h, (const uint16_t*)data);
+}
+
+void TFT_eSPI::pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+    pushImage(x, y, w, h, (const uint16_t*)data);
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer) {
+    pushImage(x, y, w, h, (const uint16_t*)data);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+    if (x < 0 || x >= SIM_WIDTH || y < 0 || y >= SIM_HEIGHT) return 0;
+    return swap16(simGram[y][x]);
+}
+
+void TFT_eSPI::readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+    // 3 bytes a pixel at SPI_READ_FREQUENCY, charged as the same time on
+    // the write clock
+    simBusBytes += (uint64_t)w * h * 3 * SPI_FREQUENCY / SPI_READ_FREQUENCY;
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) *data++ = readPixel(x + col, y + row);
+    }
+}
+
+// ============================================================================
+// SPRITES
+// ============================================================================
+
+// TFT_eSPI's default 4-bit palette
+static const uint16_t defaultPalette[16] = {
+    TFT_BLACK, 0x000F, 0x03E0, 0x03EF, 0x7800, 0x780F, 0x7BE0, 0xD69A,
+    0x7BEF, TFT_BLUE, TFT_GREEN, 0x07FF, TFT_RED, TFT_MAGENTA, TFT_YELLOW, TFT_WHITE,
+};
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(0, 0), tft(tft), buffer(nullptr), bpp(16) {
+    memcpy(palette, defaultPalette, sizeof(palette));
+}
+
+void* TFT_eSprite::setColorDepth(int8_t bits) {
+    bpp = bits == 4 ? 4 : 16;
+    return buffer;
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+    if (buffer) return buffer;
+    size_t bytes = bpp == 4 ? (size_t)((w + 1) / 2) * h : (size_t)w * h * 2;
+    buffer = (uint8_t*)calloc(bytes, 1);
+    if (!buffer) return nullptr;
+    _width = w;
+    _height = h;
+    return buffer;
+}
+
+void TFT_eSprite::deleteSprite() {
+    free(buffer);
+    buffer = nullptr;
+    _width = _height = 0;
+}
+
+void TFT_eSprite::createPalette(uint16_t* colors, uint8_t count) {
+    createPalette((const uint16_t*)colors, count);
+}
+
+void TFT_eSprite::createPalette(const uint16_t* colors, uint8_t count) {
+    memcpy(palette, defaultPalette, sizeof(palette));
+    if (colors) memcpy(palette, colors, min((int)count, 16) * sizeof(uint16_t));
+}
+
+void TFT_eSprite::setPaletteColor(uint8_t index, uint16_t color) {
+    palette[index & 0x0F] = color;
+}
+
+uint16_t TFT_eSprite::getPaletteColor(uint8_t index) {
+    return palette[index & 0x0F];
+}
+
+// 16-bit pixels are stored byte-swapped; 4-bit ones take the color as an index
+void TFT_eSprite::writeBlock(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    if (!buffer) return;
+    int32_t x0 = max(x, (int32_t)0), x1 = min(x + w, (int32_t)_width);
+    int32_t y0 = max(y, (int32_t)0), y1 = min(y + h, (int32_t)_height);
+    for (int32_t row = y0; row < y1; row++) {
+        for (int32_t col = x0; col < x1; col++) {
+            if (bpp == 16) {
+                ((uint16_t*)buffer)[row * _width + col] = swap16((uint16_t)color);
+            } else {
+                uint8_t* p = buffer + (row * _width + col) / 2;
+                if (col & 1) *p = (*p & 0xF0) | (color & 0x0F);
+                else *p = (*p & 0x0F) | ((color & 0x0F) << 4);
+            }
+        }
+    }
+}
+
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y) {
+    if (!buffer || x < 0 || x >= _width || y < 0 || y >= _height) return 0;
+    if (bpp == 16) return swap16(((uint16_t*)buffer)[y * _width + x]);
+    uint8_t pair = buffer[(y * _width + x) / 2];
+    return palette[(x & 1) ? (pair & 0x0F) : (pair >> 4)];
+}
+
+void TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint8_t sbpp) {
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) {
+            uint16_t raw = data[row * w + col];
+            writeBlock(x + col, y + row, 1, 1, bpp == 16 ? swap16(raw) : raw);
+        }
+    }
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+    if (!buffer) return;
+    std::vector<uint16_t> wire((size_t)_width * _height);
+    for (int32_t row = 0; row < _height; row++) {
+        for (int32_t col = 0; col < _width; col++) {
+            wire[row * _width + col] = swap16(readPixel(col, row));
+        }
+    }
+    bool swap = tft->getSwapBytes();
+    tft->setSwapBytes(false);
+    tft->pushImage(x, y, _width, _height, wire.data());
+    tft->setSwapBytes(swap);
+}
@@ -0,0 +1,191 @@
+// TFT_eSPI.h - A software ILI9341 for the desktop simulator
+//
+// Same class shape as TFT_eSPI 2.5.43 where the firmware touches it: the
+// leaf draw calls (pixel, fills, lines, glyphs) are virtual so DisplayList,
+// TftProfiler and IndexedCanvas override them exactly as on the board, and
+// every composite primitive (rounded rects, circles, text) funnels into
+// them the way the library does. Only the built-in GLCD font is drawn.
+//
+// Every TFT_eSPI that isn't a sprite writes to the one simulated panel
+// (simGram in SimHost.h), counting pixels and primitives for the overlay.
+// Pushed pixel data is in panel byte order unless setSwapBytes(true), as
+// on the board; sprites store 16-bit pixels byte-swapped and 4-bit pixels
+// as palette indices.
+
+#pragma once
+
+#include <Arduino.h>
+
+#define TFT_ESPI_VERSION "2.5.43-sim"
+
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_MAROON 0x7800
+#define TFT_DARKGREY 0x7BEF
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_CYAN 0x07FF
+#define TFT_RED 0xF800
+#define TFT_MAGENTA 0xF81F
+#define TFT_YELLOW 0xFFE0
+#define TFT_ORANGE 0xFDA0
+#define TFT_WHITE 0xFFFF
+#define TFT_TRANSPARENT 0x0120
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+
+class TFT_eSPI : public Print {
+public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    virtual ~TFT_eSPI() {}
+
+    void init(uint8_t tc = 0);
+    void begin(uint8_t tc = 0) { init(tc); }
+    void setRotation(uint8_t r) { rotation = r & 3; }
+    uint8_t getRotation() { return rotation; }
+    void resetViewport() {}
+
+    // Leaf calls - everything below ends up in one of these
+    virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+    virtual void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+    virtual void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color);
+    virtual void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+    virtual void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+    virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    virtual int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font);
+    virtual int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y);
+    virtual int16_t width() { return _width; }
+    virtual int16_t height() { return _height; }
+
+    void fillScreen(uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+
+    // Address window and pixel pushes (panel only)
+    void setAddrWindow(int32_t xs, int32_t ys, int32_t w, int32_t h);
+    void setWindow(int32_t xs, int32_t ys, int32_t xe, int32_t ye);
+    void pushColor(uint16_t color);
+    void pushColor(uint16_t color, uint32_t len);
+    void pushColors(uint16_t* data, uint32_t len, bool swap = true);
+    void pushBlock(uint16_t color, uint32_t len);
+    void pushPixels(const void* data, uint32_t len);
+    void pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+    // Read back as readRect() does on the ILI9341: RGB565, byte-swapped
+    uint16_t readPixel(int32_t x, int32_t y);
+    void readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+
+    // DMA completes immediately
+    bool initDMA(bool ctrlCs = false) { return true; }
+    void deInitDMA() {}
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = nullptr);
+    void pushPixelsDMA(uint16_t* image, uint32_t len) { pushPixels(image, len); }
+    bool dmaBusy() { return false; }
+    void dmaWait() {}
+
+    void startWrite() {}
+    void endWrite() {}
+    void setSwapBytes(bool swap) { swapBytes = swap; }
+    bool getSwapBytes() { return swapBytes; }
+
+    // Text - GLCD font only, 6 x 8 pixels per character before scaling
+    void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+    int16_t getCursorX() { return cursor_x; }
+    int16_t getCursorY() { return cursor_y; }
+    void setTextColor(uint16_t color) { textcolor = textbgcolor = color; }
+    void setTextColor(uint16_t fg, uint16_t bg, bool bgfill = false) { textcolor = fg; textbgcolor = bg; }
+    void setTextSize(uint8_t size) { textsize = size > 0 ? size : 1; }
+    void setTextDatum(uint8_t datum) { textdatum = datum; }
+    void setTextFont(uint8_t font) {}
+    void setTextWrap(bool wrapX, bool wrapY = false) { textwrapX = wrapX; }
+    int16_t textWidth(const char* text) { return strlen(text) * 6 * textsize; }
+    int16_t fontHeight() { return 8 * textsize; }
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    // The simulator's mouse goes through the firmware's scripted touches
+    // instead - the panel never reports pressure
+    uint8_t getTouch(uint16_t* x, uint16_t* y, uint16_t threshold = 600) { return 0; }
+    uint8_t getTouchRaw(uint16_t* x, uint16_t* y) { *x = *y = 0; return 0; }
+    uint16_t getTouchRawZ() { return 0; }
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+        return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+
+    int32_t cursor_x, cursor_y;
+    uint32_t textcolor, textbgcolor;
+    uint8_t textsize, textdatum;
+    bool textwrapX;
+
+protected:
+    // Where the leaf calls land: a clipped solid block. The panel writes
+    // simGram and counts; sprites write their buffer.
+    virtual void writeBlock(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    // One leaf call reached the panel
+    virtual void countPrimitive();
+
+    void drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, uint32_t color);
+    void fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, int32_t delta, uint32_t color);
+
+    int32_t _width, _height;
+    uint8_t rotation;
+    bool swapBytes;
+
+private:
+    // Address window and write position for pushPixels() and friends
+    int32_t winX0, winY0, winX1, winY1;
+    int32_t winX, winY;
+
+    void pushWindowPixel(uint16_t color);
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+    explicit TFT_eSprite(TFT_eSPI* tft);
+    ~TFT_eSprite() override { deleteSprite(); }
+
+    void* setColorDepth(int8_t bits);
+    int8_t getColorDepth() { return bpp; }
+    void* createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+    void deleteSprite();
+    bool created() { return buffer != nullptr; }
+    void* getPointer() { return buffer; }
+
+    void createPalette(uint16_t* colors = nullptr, uint8_t count = 16);
+    void createPalette(const uint16_t* colors = nullptr, uint8_t count = 16);
+    void setPaletteColor(uint8_t index, uint16_t color);
+    uint16_t getPaletteColor(uint8_t index);
+
+    void fillSprite(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+    void pushSprite(int32_t x, int32_t y);
+
+    uint16_t readPixel(int32_t x, int32_t y);
+    // RGB565 in panel byte order into a 16-bit sprite; indices into a 4-bit one
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint8_t sbpp = 0);
+
+protected:
+    void writeBlock(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+    void countPrimitive() override {}
+
+private:
+    TFT_eSPI* tft;
+    uint8_t* buffer;
+    int8_t bpp;
+    uint16_t palette[16];
+};
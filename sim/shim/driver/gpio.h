@@ -0,0 +1,10 @@
+// driver/gpio.h - Wakeup pins (accepted and ignored)
+
+#pragma once
+
+#include "esp_system.h"
+
+typedef enum { GPIO_NUM_26 = 26, GPIO_NUM_27 = 27, GPIO_NUM_36 = 36 } gpio_num_t;
+typedef enum { GPIO_INTR_LOW_LEVEL = 4 } gpio_int_type_t;
+
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type);
@@ -0,0 +1,47 @@
+// driver/i2s.h - The sound task is compiled but, with SOUND_ENABLED=0, never
+// started; these only have to link
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "esp_system.h"
+
+typedef int i2s_port_t;
+enum { I2S_NUM_0 = 0 };
+typedef int i2s_mode_t;
+enum { I2S_MODE_MASTER = 1, I2S_MODE_TX = 4, I2S_MODE_DAC_BUILT_IN = 16 };
+typedef int i2s_bits_per_sample_t;
+enum { I2S_BITS_PER_SAMPLE_16BIT = 16 };
+typedef int i2s_channel_fmt_t;
+enum { I2S_CHANNEL_FMT_RIGHT_LEFT = 0, I2S_CHANNEL_FMT_ONLY_LEFT = 4 };
+typedef int i2s_comm_format_t;
+enum { I2S_COMM_FORMAT_STAND_I2S = 1, I2S_COMM_FORMAT_STAND_MSB = 2 };
+typedef int i2s_dac_mode_t;
+enum { I2S_DAC_CHANNEL_DISABLE = 0, I2S_DAC_CHANNEL_RIGHT_EN = 1, I2S_DAC_CHANNEL_LEFT_EN = 2 };
+
+typedef struct {
+    i2s_mode_t mode;
+    uint32_t sample_rate;
+    i2s_bits_per_sample_t bits_per_sample;
+    i2s_channel_fmt_t channel_format;
+    i2s_comm_format_t communication_format;
+    int intr_alloc_flags;
+    int dma_buf_count;
+    int dma_buf_len;
+    bool use_apll;
+    bool tx_desc_auto_clear;
+    int fixed_mclk;
+} i2s_config_t;
+
+typedef struct {
+    int bck_io_num;
+} i2s_pin_config_t;
+
+esp_err_t i2s_driver_install(i2s_port_t port, const i2s_config_t* config, int queueSize, void* queue);
+esp_err_t i2s_set_pin(i2s_port_t port, const i2s_pin_config_t* pins);
+esp_err_t i2s_set_dac_mode(i2s_dac_mode_t mode);
+esp_err_t i2s_write(i2s_port_t port, const void* data, size_t size, size_t* written, uint32_t ticks);
+esp_err_t i2s_start(i2s_port_t port);
+esp_err_t i2s_stop(i2s_port_t port);
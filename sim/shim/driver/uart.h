@@ -0,0 +1,9 @@
+// driver/uart.h - UART wakeup threshold (accepted and ignored)
+
+#pragma once
+
+#include "esp_system.h"
+
+typedef enum { UART_NUM_0 = 0 } uart_port_t;
+
+esp_err_t uart_set_wakeup_threshold(uart_port_t uart, int edges);
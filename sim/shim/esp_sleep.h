@@ -0,0 +1,28 @@
+// esp_sleep.h - Light sleep moves the simulator's clock on
+//
+// A sleep ends at its timer, or early when a mouse press or console input
+// arrives - the touch and UART wakeups on the board.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "esp_system.h"
+#include "driver/gpio.h"
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED = 0,
+    ESP_SLEEP_WAKEUP_TIMER = 4,
+    ESP_SLEEP_WAKEUP_GPIO = 7,
+    ESP_SLEEP_WAKEUP_UART = 8,
+} esp_sleep_wakeup_cause_t;
+
+typedef enum { ESP_PD_DOMAIN_RTC8M = 3 } esp_sleep_pd_domain_t;
+typedef enum { ESP_PD_OPTION_OFF, ESP_PD_OPTION_ON, ESP_PD_OPTION_AUTO } esp_sleep_pd_option_t;
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us);
+esp_err_t esp_sleep_enable_gpio_wakeup();
+esp_err_t esp_sleep_enable_uart_wakeup(int uart);
+esp_err_t esp_sleep_pd_config(esp_sleep_pd_domain_t domain, esp_sleep_pd_option_t option);
+esp_err_t esp_light_sleep_start();
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause();
@@ -0,0 +1,12 @@
+// esp_system.h - ESP-IDF error codes and the hardware RNG
+
+#pragma once
+
+#include <stdint.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+// The simulator's --seed when given, so runs repeat
+uint32_t esp_random();
@@ -0,0 +1,9 @@
+// esp_timer.h - Microseconds since boot, from the simulator's clock
+
+#pragma once
+
+#include <stdint.h>
+
+#include "esp_system.h"
+
+int64_t esp_timer_get_time();
@@ -0,0 +1,16 @@
+// nvs.h - Entry counts for the simulator's in-memory Preferences
+
+#pragma once
+
+#include <stddef.h>
+
+#include "esp_system.h"
+
+typedef struct {
+    size_t used_entries;
+    size_t free_entries;
+    size_t total_entries;
+    size_t namespace_count;
+} nvs_stats_t;
+
+esp_err_t nvs_get_stats(const char* part_name, nvs_stats_t* stats);
@@ -0,0 +1,258 @@
+// DisplayList.cpp - Recorded draw calls, culled and merged before sending
+
+#include "DisplayList.h"
+
+DisplayList::DisplayList(TFT_eSPI* target)
+    : TFT_eSPI(), target(target), count(0), counters{} {}
+
+void DisplayList::begin() {
+    _width = target->width();
+    _height = target->height();
+    rotation = target->getRotation();
+    resetViewport();
+}
+
+// ---- Recording ----
+
+// Full list - send what we have and keep recording
+DisplayList::Op* DisplayList::add() {
+    if (count >= DISPLAY_LIST_OPS) submit();
+    counters.recorded++;
+    return &ops[count++];
+}
+
+void DisplayList::addFill(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    // Clip to the screen so bounds can be compared directly
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _width) w = _width - x;
+    if (y + h > _height) h = _height - y;
+    if (w <= 0 || h <= 0) return;
+
+    Op* op = add();
+    op->type = OP_FILL;
+    op->color = color;
+    op->x = x;
+    op->y = y;
+    op->w = w;
+    op->h = h;
+}
+
+void DisplayList::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    addFill(x, y, w, h, color);
+}
+
+void DisplayList::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    addFill(x, y, w, 1, color);
+}
+
+void DisplayList::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+    addFill(x, y, 1, h, color);
+}
+
+void DisplayList::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    addFill(x, y, 1, 1, color);
+}
+
+void DisplayList::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+    if (size == 0) size = 1;
+    if (x >= _width || y >= _height || x + 6 * size <= 0 || y + 8 * size <= 0) return;
+
+    Op* op = add();
+    op->type = OP_CHAR;
+    op->size = size;
+    op->color = color;
+    op->x = x;
+    op->y = y;
+    op->w = 6 * size;
+    op->h = 8 * size;
+    op->glyph.code = c;
+    op->glyph.bg = bg;
+}
+
+void DisplayList::drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) {
+    if (xs == xe || ys == ye) {
+        addFill(min(xs, xe), min(ys, ye), abs(xe - xs) + 1, abs(ye - ys) + 1, color);
+        return;
+    }
+
+    Op* op = add();
+    op->type = OP_LINE;
+    op->color = color;
+    op->x = min(xs, xe);
+    op->y = min(ys, ye);
+    op->w = abs(xe - xs) + 1;
+    op->h = abs(ye - ys) + 1;
+    op->line.xs = xs;
+    op->line.ys = ys;
+    op->line.xe = xe;
+    op->line.ye = ye;
+}
+
+void DisplayList::pushWindow(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* pixels) {
+    if (w <= 0 || h <= 0) return;
+
+    Op* op = add();
+    op->type = OP_PIXELS;
+    op->color = 0;
+    op->x = x;
+    op->y = y;
+    op->w = w;
+    op->h = h;
+    op->pixels = pixels;
+}
+
+// ---- Optimizing ----
+
+bool DisplayList::contains(const Rect& outer, const Op& op) {
+    return op.x >= outer.x && op.y >= outer.y &&
+           op.x + op.w <= outer.x + outer.w && op.y + op.h <= outer.y + outer.h;
+}
+
+bool DisplayList::overlaps(const Rect& area, const Op& op) {
+    return op.x < area.x + area.w && area.x < op.x + op.w &&
+           op.y < area.y + area.h && area.y < op.y + op.h;
+}
+
+// Pixel bytes a call sends, when that is known from its bounds
+uint32_t DisplayList::opBytes(const Op& op) {
+    if (op.type == OP_FILL || op.type == OP_PIXELS) return (uint32_t)op.w * op.h * 2;
+    if (op.type == OP_CHAR && op.glyph.bg != op.color) return (uint32_t)op.w * op.h * 2;
+    return 0;
+}
+
+// Back to front: a call is dead if a fill or pixel window recorded after it
+// covers it all. Only the largest are kept as occluders, which catches backgrounds
+// and boxes without making this quadratic in the list length.
+void DisplayList::cull() {
+    Rect occluders[DISPLAY_LIST_OCCLUDERS];
+    uint32_t areas[DISPLAY_LIST_OCCLUDERS];
+    int numOccluders = 0;
+
+    for (int i = count - 1; i >= 0; i--) {
+        Op& op = ops[i];
+
+        bool covered = false;
+        for (int j = 0; j < numOccluders && !covered; j++) {
+            covered = contains(occluders[j], op);
+        }
+        if (covered) {
+            counters.culled++;
+            counters.bytesCulled += opBytes(op);
+            op.type = OP_DEAD;
+            continue;
+        }
+
+        uint32_t area = (uint32_t)op.w * op.h;
+        bool opaque = op.type == OP_FILL || op.type == OP_PIXELS;
+        if (!opaque || area < DISPLAY_LIST_MIN_OCCLUDER) continue;
+
+        int slot = numOccluders;
+        if (numOccluders == DISPLAY_LIST_OCCLUDERS) {
+            // Replace the smallest, if this one is bigger
+            slot = 0;
+            for (int j = 1; j < numOccluders; j++) {
+                if (areas[j] < areas[slot]) slot = j;
+            }
+            if (areas[slot] >= area) continue;
+        } else {
+            numOccluders++;
+        }
+        occluders[slot] = {op.x, op.y, op.w, op.h};
+        areas[slot] = area;
+    }
+}
+
+// Front to back: a fill folds into the live fill just before it when both
+// are the same color and together they make one rectangle. Nothing is
+// drawn between them, so the order on screen doesn't change.
+void DisplayList::merge() {
+    Op* prev = nullptr;
+    for (int i = 0; i < count; i++) {
+        Op& op = ops[i];
+        if (op.type == OP_DEAD) continue;
+
+        if (prev && prev->type == OP_FILL && op.type == OP_FILL && prev->color == op.color) {
+            bool rows = prev->y == op.y && prev->h == op.h &&
+                        op.x <= prev->x + prev->w && prev->x <= op.x + op.w;
+            bool cols = prev->x == op.x && prev->w == op.w &&
+                        op.y <= prev->y + prev->h && prev->y <= op.y + op.h;
+            if (rows || cols) {
+                int16_t x0 = min(prev->x, op.x), y0 = min(prev->y, op.y);
+                int16_t x1 = max(prev->x + prev->w, op.x + op.w);
+                int16_t y1 = max(prev->y + prev->h, op.y + op.h);
+                uint32_t before = (uint32_t)prev->w * prev->h + (uint32_t)op.w * op.h;
+                uint32_t after = (uint32_t)(x1 - x0) * (y1 - y0);
+
+                prev->x = x0;
+                prev->y = y0;
+                prev->w = x1 - x0;
+                prev->h = y1 - y0;
+                op.type = OP_DEAD;
+                counters.merged++;
+                counters.bytesMerged += DISPLAY_LIST_WINDOW_BYTES + (before - after) * 2;
+                continue;
+            }
+        }
+        prev = &op;
+    }
+}
+
+void DisplayList::replay() {
+    target->startWrite();
+    for (int i = 0; i < count; i++) {
+        const Op& op = ops[i];
+        switch (op.type) {
+            case OP_FILL:
+                target->fillRect(op.x, op.y, op.w, op.h, op.color);
+                break;
+            case OP_CHAR:
+                target->drawChar(op.x, op.y, op.glyph.code, op.color, op.glyph.bg, op.size);
+                break;
+            case OP_LINE:
+                target->drawLine(op.line.xs, op.line.ys, op.line.xe, op.line.ye, op.color);
+                break;
+            case OP_PIXELS:
+                target->setAddrWindow(op.x, op.y, op.w, op.h);
+                target->pushPixels(op.pixels, (uint32_t)op.w * op.h);
+                break;
+            default:
+                continue;
+        }
+        counters.submitted++;
+    }
+    target->endWrite();
+}
+
+// ---- Submitting ----
+
+void DisplayList::submit() {
+    if (count == 0) return;
+    cull();
+    merge();
+    replay();
+    count = 0;
+}
+
+void DisplayList::occlude(int32_t x, int32_t y, int32_t w, int32_t h) {
+    Rect area = {(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h};
+    bool underneath = false;
+    for (int i = 0; i < count; i++) {
+        if (ops[i].type == OP_DEAD) continue;
+        if (contains(area, ops[i])) {
+            counters.culled++;
+            counters.bytesCulled += opBytes(ops[i]);
+            ops[i].type = OP_DEAD;
+        } else if (overlaps(area, ops[i])) {
+            underneath = true;
+        }
+    }
+    // Nothing pending touches the area, so the order doesn't matter yet
+    if (underneath) submit();
+}
+
+DisplayListCounters DisplayList::takeCounters() {
+    DisplayListCounters taken = counters;
+    counters = DisplayListCounters{};
+    return taken;
+}
@@ -0,0 +1,253 @@
+// IndexedCanvas.cpp - Full-screen 4-bpp palette framebuffer
+
+#include "IndexedCanvas.h"
+
+IndexedCanvas::IndexedCanvas(TFT_eSPI* display)
+    : TFT_eSprite(display), display(display), lineBuffers{nullptr, nullptr},
+      lastColor(0), lastIndex(0), translating(false), dmaReady(false) {
+    markAllDirty();
+}
+
+bool IndexedCanvas::begin(const uint16_t* palette) {
+    setColorDepth(4);
+    if (!createSprite(CANVAS_WIDTH, CANVAS_HEIGHT)) return false;
+
+    for (int i = 0; i < 2; i++) {
+        lineBuffers[i] = (uint16_t*)malloc(CANVAS_WIDTH * CANVAS_BAND_LINES * sizeof(uint16_t));
+        if (!lineBuffers[i]) {
+            deleteSprite();
+            return false;
+        }
+    }
+
+    memcpy(basePalette, palette, sizeof(basePalette));
+    createPalette(basePalette, CANVAS_PALETTE_SIZE);
+    restorePalette();
+    lastColor = basePalette[0];
+    lastIndex = 0;
+
+    dmaReady = display->initDMA();
+    return true;
+}
+
+// ---- Palette ----
+
+void IndexedCanvas::setPaletteEntry(uint8_t index, uint16_t color,
+                                    int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (index >= CANVAS_PALETTE_SIZE) return;
+    wirePalette[index] = (color >> 8) | (color << 8);
+    markDirty(x, y, w, h);
+}
+
+void IndexedCanvas::fillPalette(uint16_t color) {
+    for (int i = 0; i < CANVAS_PALETTE_SIZE; i++) {
+        wirePalette[i] = (color >> 8) | (color << 8);
+    }
+    markAllDirty();
+}
+
+void IndexedCanvas::restorePalette() {
+    for (int i = 0; i < CANVAS_PALETTE_SIZE; i++) {
+        wirePalette[i] = (basePalette[i] >> 8) | (basePalette[i] << 8);
+    }
+    markAllDirty();
+}
+
+uint8_t IndexedCanvas::indexOf(uint16_t color) {
+    // Drawing tends to repeat one color many times in a row
+    if (color == lastColor) return lastIndex;
+
+    int r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+    uint8_t best = 0;
+    int32_t bestDist = INT32_MAX;
+    for (int i = 0; i < CANVAS_PALETTE_SIZE; i++) {
+        uint16_t p = basePalette[i];
+        int dr = r - (p >> 11);
+        int dg = g - ((p >> 5) & 0x3F);
+        int db = b - (p & 0x1F);
+        // Scale red and blue to green's 6-bit range
+        int32_t dist = 4 * dr * dr + dg * dg + 4 * db * db;
+        if (dist < bestDist) {
+            bestDist = dist;
+            best = i;
+            if (dist == 0) break;
+        }
+    }
+
+    lastColor = color;
+    lastIndex = best;
+    return best;
+}
+
+// ---- Dirty tracking ----
+
+void IndexedCanvas::markDirty(int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (w <= 0 || h <= 0) return;
+    int32_t x0 = max(x, (int32_t)0), x1 = min(x + w - 1, (int32_t)CANVAS_WIDTH - 1);
+    int32_t y0 = max(y, (int32_t)0), y1 = min(y + h - 1, (int32_t)CANVAS_HEIGHT - 1);
+    if (x0 > x1 || y0 > y1) return;
+
+    for (int band = y0 / CANVAS_BAND_LINES; band <= y1 / CANVAS_BAND_LINES; band++) {
+        if (dirtyX1[band] < dirtyX0[band]) {
+            dirtyX0[band] = x0;
+            dirtyX1[band] = x1;
+        } else {
+            if (x0 < dirtyX0[band]) dirtyX0[band] = x0;
+            if (x1 > dirtyX1[band]) dirtyX1[band] = x1;
+        }
+    }
+}
+
+void IndexedCanvas::markAllDirty() {
+    for (int band = 0; band < NUM_BANDS; band++) {
+        dirtyX0[band] = 0;
+        dirtyX1[band] = CANVAS_WIDTH - 1;
+    }
+}
+
+// ---- Push to panel ----
+
+void IndexedCanvas::expandBand(int band, int16_t x0, int16_t x1, uint16_t* out) {
+    const uint8_t* pixels = (const uint8_t*)getPointer();
+    int y0 = band * CANVAS_BAND_LINES;
+    int y1 = min(y0 + CANVAS_BAND_LINES, CANVAS_HEIGHT);
+
+    // x0 is even and x1 odd, so every byte holds two pixels of the span
+    for (int y = y0; y < y1; y++) {
+        const uint8_t* src = pixels + (y * CANVAS_WIDTH + x0) / 2;
+        for (int x = x0; x <= x1; x += 2) {
+            uint8_t pair = *src++;
+            *out++ = wirePalette[pair >> 4];
+            *out++ = wirePalette[pair & 0x0F];
+        }
+    }
+}
+
+void IndexedCanvas::flush() {
+    if (!created()) return;
+
+    // Expand one band while DMA sends the previous one. pushImageDMA waits
+    // for the transfer in flight before starting, so by the time a buffer
+    // is refilled its last transfer has finished.
+    int buffer = 0;
+    bool writing = false;
+
+    for (int band = 0; band < NUM_BANDS; band++) {
+        if (dirtyX1[band] < dirtyX0[band]) continue;
+
+        int16_t x0 = dirtyX0[band] & ~1;
+        int16_t x1 = dirtyX1[band] | 1;
+        int y = band * CANVAS_BAND_LINES;
+        int h = min(CANVAS_BAND_LINES, CANVAS_HEIGHT - y);
+
+        if (!writing) {
+            display->startWrite();
+            writing = true;
+        }
+
+        expandBand(band, x0, x1, lineBuffers[buffer]);
+        if (dmaReady) {
+            display->pushImageDMA(x0, y, x1 - x0 + 1, h, lineBuffers[buffer]);
+            buffer ^= 1;
+        } else {
+            display->pushImage(x0, y, x1 - x0 + 1, h, lineBuffers[buffer]);
+        }
+
+        dirtyX0[band] = CANVAS_WIDTH;
+        dirtyX1[band] = -1;
+    }
+
+    if (writing) {
+        if (dmaReady) display->dmaWait();
+        display->endWrite();
+    }
+}
+
+// ---- RGB565 blit ----
+
+void IndexedCanvas::pushImage565(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    uint8_t* pixels = (uint8_t*)getPointer();
+    if (!pixels) return;
+
+    for (int32_t row = 0; row < h; row++) {
+        int32_t py = y + row;
+        if (py < 0 || py >= CANVAS_HEIGHT) continue;
+        for (int32_t col = 0; col < w; col++) {
+            int32_t px = x + col;
+            if (px < 0 || px >= CANVAS_WIDTH) continue;
+
+            uint16_t wire = data[row * w + col];
+            uint8_t index = indexOf((wire >> 8) | (wire << 8));
+            uint8_t* p = pixels + (py * CANVAS_WIDTH + px) / 2;
+            if (px & 1) *p = (*p & 0xF0) | index;
+            else *p = (*p & 0x0F) | (index << 4);
+        }
+    }
+    markDirty(x, y, w, h);
+}
+
+// ---- Drawing (RGB565 in, palette index stored) ----
+
+void IndexedCanvas::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    if (translating) {
+        TFT_eSprite::drawPixel(x, y, color);
+        return;
+    }
+    markDirty(x, y, 1, 1);
+    TFT_eSprite::drawPixel(x, y, indexOf(color));
+}
+
+void IndexedCanvas::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+    if (translating) {
+        TFT_eSprite::drawChar(x, y, c, color, bg, size);
+        return;
+    }
+    markDirty(x, y, 6 * size, 8 * size);
+    translating = true;
+    TFT_eSprite::drawChar(x, y, c, indexOf(color), indexOf(bg), size);
+    translating = false;
+}
+
+void IndexedCanvas::drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) {
+    if (translating) {
+        TFT_eSprite::drawLine(xs, ys, xe, ye, color);
+        return;
+    }
+    markDirty(min(xs, xe), min(ys, ye), abs(xe - xs) + 1, abs(ye - ys) + 1);
+    translating = true;
+    TFT_eSprite::drawLine(xs, ys, xe, ye, indexOf(color));
+    translating = false;
+}
+
+void IndexedCanvas::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+    if (translating) {
+        TFT_eSprite::drawFastVLine(x, y, h, color);
+        return;
+    }
+    markDirty(x, y, 1, h);
+    translating = true;
+    TFT_eSprite::drawFastVLine(x, y, h, indexOf(color));
+    translating = false;
+}
+
+void IndexedCanvas::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    if (translating) {
+        TFT_eSprite::drawFastHLine(x, y, w, color);
+        return;
+    }
+    markDirty(x, y, w, 1);
+    translating = true;
+    TFT_eSprite::drawFastHLine(x, y, w, indexOf(color));
+    translating = false;
+}
+
+void IndexedCanvas::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    if (translating) {
+        TFT_eSprite::fillRect(x, y, w, h, color);
+        return;
+    }
+    markDirty(x, y, w, h);
+    translating = true;
+    TFT_eSprite::fillRect(x, y, w, h, indexOf(color));
+    translating = false;
+}
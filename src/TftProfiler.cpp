@@ -0,0 +1,214 @@
+// TftProfiler.cpp - Per-call-site panel bus accounting
+
+#include "TftProfiler.h"
+
+#include <esp_timer.h>
+
+const char* TftProfiler::scopes[TFT_PROFILE_DEPTH];
+uint8_t TftProfiler::depth = 0;
+
+TftProfiler::TftProfiler(TFT_eSPI* target)
+    : TFT_eSPI(), target(target), context(nullptr), numSites(0), droppedCalls(0),
+      numContexts(0), frameUs(0), frameContext(nullptr), lastSite(nullptr) {}
+
+void TftProfiler::begin(const char* (*contextFn)()) {
+    context = contextFn;
+    _width = target->width();
+    _height = target->height();
+    rotation = target->getRotation();
+    resetViewport();
+}
+
+// ---- Scopes ----
+
+void TftProfiler::pushScope(const char* name) {
+    if (depth < TFT_PROFILE_DEPTH) scopes[depth] = name;
+    depth++;
+}
+
+void TftProfiler::popScope() {
+    if (depth > 0) depth--;
+}
+
+// ---- Accounting ----
+
+// Call sites repeat in runs (a loop of fills), so the last hit is checked first
+TftSite* TftProfiler::site() {
+    const char* ctx = context ? context() : "";
+    uint8_t d = depth < TFT_PROFILE_DEPTH ? depth : TFT_PROFILE_DEPTH;
+
+    auto matches = [&](const TftSite& s) {
+        if (s.context != ctx || s.depth != d) return false;
+        for (uint8_t i = 0; i < d; i++) {
+            if (s.scopes[i] != scopes[i]) return false;
+        }
+        return true;
+    };
+
+    if (lastSite && matches(*lastSite)) return lastSite;
+    for (uint16_t i = 0; i < numSites; i++) {
+        if (matches(sites[i])) return lastSite = &sites[i];
+    }
+    if (numSites == TFT_PROFILE_SITES) return nullptr;
+
+    TftSite& s = sites[numSites++];
+    s.context = ctx;
+    s.depth = d;
+    for (uint8_t i = 0; i < d; i++) s.scopes[i] = scopes[i];
+    s.stats = TftSiteStats{};
+    return lastSite = &s;
+}
+
+// One windowed transfer of the given pixels, started at startUs
+void TftProfiler::charge(uint32_t pixels, int64_t startUs) {
+    uint32_t us = esp_timer_get_time() - startUs;
+    frameUs += us;
+    if (!frameContext && context) frameContext = context();
+
+    TftSite* s = site();
+    if (!s) {
+        droppedCalls++;
+        return;
+    }
+    s->stats.calls++;
+    s->stats.pixels += pixels;
+    s->stats.bytes += pixels * 2 + TFT_PROFILE_WINDOW_BYTES;
+    s->stats.transactions++;
+    s->stats.us += us;
+}
+
+void TftProfiler::recordPush(uint32_t pixels, int64_t startUs) {
+    charge(pixels, startUs);
+}
+
+void TftProfiler::endFrame() {
+    if (frameUs == 0) return;
+
+    TftFrameStats* f = nullptr;
+    for (uint8_t i = 0; i < numContexts; i++) {
+        if (frames[i].context == frameContext) f = &frames[i];
+    }
+    if (!f && numContexts < TFT_PROFILE_CONTEXTS) {
+        f = &frames[numContexts++];
+        *f = TftFrameStats{frameContext, 0, 0, 0};
+    }
+    if (f) {
+        f->frames++;
+        f->us += frameUs;
+        if (frameUs > f->worstUs) f->worstUs = frameUs;
+    }
+    frameUs = 0;
+    frameContext = nullptr;
+}
+
+void TftProfiler::reset() {
+    numSites = 0;
+    numContexts = 0;
+    droppedCalls = 0;
+    frameUs = 0;
+    frameContext = nullptr;
+    lastSite = nullptr;
+}
+
+// ---- Forwarded draw calls ----
+
+static uint32_t clippedArea(int32_t x, int32_t y, int32_t w, int32_t h, int32_t width, int32_t height) {
+    int32_t x0 = max(x, (int32_t)0), x1 = min(x + w, width);
+    int32_t y0 = max(y, (int32_t)0), y1 = min(y + h, height);
+    return (x1 > x0 && y1 > y0) ? (uint32_t)(x1 - x0) * (y1 - y0) : 0;
+}
+
+void TftProfiler::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    int64_t start = esp_timer_get_time();
+    target->fillRect(x, y, w, h, color);
+    charge(clippedArea(x, y, w, h, _width, _height), start);
+}
+
+void TftProfiler::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    int64_t start = esp_timer_get_time();
+    target->drawFastHLine(x, y, w, color);
+    charge(clippedArea(x, y, w, 1, _width, _height), start);
+}
+
+void TftProfiler::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+    int64_t start = esp_timer_get_time();
+    target->drawFastVLine(x, y, h, color);
+    charge(clippedArea(x, y, 1, h, _width, _height), start);
+}
+
+void TftProfiler::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    int64_t start = esp_timer_get_time();
+    target->drawPixel(x, y, color);
+    charge(clippedArea(x, y, 1, 1, _width, _height), start);
+}
+
+void TftProfiler::drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) {
+    int64_t start = esp_timer_get_time();
+    target->drawLine(xs, ys, xe, ye, color);
+    charge(max(abs(xe - xs), abs(ye - ys)) + 1, start);
+}
+
+// Only unclipped size-1 text on a background goes out as one block. Every
+// other glyph is a fill per font pixel (or per lit pixel when transparent) -
+// letting TFT_eSPI decompose it here charges each of those transfers.
+void TftProfiler::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+    TftScope glyph("glyph");
+    bool block = size == 1 && bg != color &&
+                 x >= 0 && y >= 0 && x + 6 < _width && y + 8 < _height;
+    if (block) {
+        int64_t start = esp_timer_get_time();
+        target->drawChar(x, y, c, color, bg, size);
+        charge(6 * 8, start);
+    } else {
+        TFT_eSPI::drawChar(x, y, c, color, bg, size);
+    }
+}
+
+// ---- Output ----
+
+void TftProfiler::printStack(Print& out, const TftSite& s) {
+    out.print(s.context && *s.context ? s.context : "(none)");
+    for (uint8_t i = 0; i < s.depth; i++) {
+        out.print(";");
+        out.print(s.scopes[i]);
+    }
+}
+
+void TftProfiler::printTable(Print& out) {
+    // Busiest sites first - a selection sort over indices keeps the table intact
+    bool printed[TFT_PROFILE_SITES] = {false};
+    out.printf("  %8s %7s %8s %9s %6s  %s\n", "us", "calls", "pixels", "bytes", "txns", "site");
+    for (uint16_t n = 0; n < numSites; n++) {
+        int best = -1;
+        for (uint16_t i = 0; i < numSites; i++) {
+            if (!printed[i] && (best < 0 || sites[i].stats.us > sites[best].stats.us)) best = i;
+        }
+        printed[best] = true;
+        const TftSiteStats& st = sites[best].stats;
+        out.printf("  %8u %7u %8u %9u %6u  ", st.us, st.calls, st.pixels, st.bytes, st.transactions);
+        printStack(out, sites[best]);
+        out.println();
+    }
+    if (droppedCalls > 0) out.printf("  (%u calls not attributed - site table full)\n", droppedCalls);
+
+    out.printf("  %-12s %7s %10s %10s\n", "screen", "frames", "avg us", "worst us");
+    for (uint8_t i = 0; i < numContexts; i++) {
+        const TftFrameStats& f = frames[i];
+        out.printf("  %-12s %7u %10u %10u\n", f.context ? f.context : "(none)",
+                   f.frames, f.frames ? f.us / f.frames : 0, f.worstUs);
+    }
+}
+
+// One "context;scope;scope value" line per site, flamegraph.pl's input format
+void TftProfiler::printFolded(Print& out, TftFoldedValue value) {
+    for (uint16_t i = 0; i < numSites; i++) {
+        const TftSiteStats& st = sites[i].stats;
+        uint32_t v = value == FOLD_BYTES ? st.bytes
+                   : value == FOLD_PIXELS ? st.pixels
+                   : value == FOLD_TRANSACTIONS ? st.transactions
+                   : st.us;
+        if (v == 0) continue;
+        printStack(out, sites[i]);
+        out.printf(" %u\n", v);
+    }
+}
@@ -17,15 +17,43 @@
 #include <TFT_eSPI.h>
 #include <SPI.h>
 #include <Preferences.h>
+#include <esp_timer.h>
+#include <esp_sleep.h>
+#include <nvs.h>
+#include <driver/gpio.h>
+#include <driver/ledc.h>
+#include <driver/uart.h>
+#include <driver/i2s.h>
+
+#include "ScreenMachine.h"
+#include "Minigame.h"
+#include "FrameScheduler.h"
+#include "FactGenerator.h"
+#include "FactMastery.h"
+#include "RoundHistory.h"
+#include "IndexedCanvas.h"
+#include "DisplayList.h"
+#include "TftProfiler.h"
+#include "RleImage.h"
+#include "ScreenAssets.h"
+#include "Color565.h"
+#include "SmoothFont.h"
+#include "SmoothFonts.h"
+#include "AudioMixer.h"
+#include "TouchFilter.h"
+#include "GestureRecognizer.h"
+#include "Rng.h"
 
 // ============================================================================
 // CONFIGURATION
 // ============================================================================
 
-// Touch calibration values for TFT_eSPI (landscape mode)
-// Format: {minX, maxX, minY, maxY, rotation}
-// Using rotation 0 - manual transformation in getTouchPoint()
-uint16_t touchCalData[5] = {300, 3600, 300, 3600, 0};
+// Touch calibration: raw XPT2046 counts -> screen pixels (see TouchFilter.h).
+// The default matches the ranges measured on a stock CYD; a 3-point
+// calibration ('touchcal' on serial, or hold the screen while powering on)
+// replaces it and is saved.
+const TouchCalibration defaultTouchCal = {6428, 0, -1928467, 0, 4660, -2097152};
+TouchCalibration touchCal = defaultTouchCal;
 bool touchCalibrated = false;
 
 // Display dimensions
@@ -33,13 +61,157 @@ bool touchCalibrated = false;
 #define SCREEN_HEIGHT 240
 
 // Game settings
-#define MIN_TABLE 1
-#define MAX_TABLE 12
-#define ANSWERS_COUNT 4
+#define ANSWERS_COUNT FACT_ANSWERS
+
+// Fact operations - each enabled one is its own launcher game with its own
+// saves. A disabled operation is compiled out entirely (tools/fact_sizes.sh
+// measures what each one costs).
+#ifndef FACTS_MUL
+#define FACTS_MUL 1
+#endif
+#ifndef FACTS_ADD
+#define FACTS_ADD 1
+#endif
+#ifndef FACTS_SUB
+#define FACTS_SUB 1
+#endif
+#ifndef FACTS_DIV
+#define FACTS_DIV 1
+#endif
+#define LEGACY_STATS_PREFIX "mq"    // Pre-profile saves belong to multiplication
+#define CLASSIC_QUESTIONS 10
+#define FEEDBACK_MS 1500
+
+// Speed rounds - the clock only runs while a question is on screen
+#define SPRINT_QUESTIONS 20
+#define SPRINT_PAR_MS 100000        // Bar length until there is a personal best
+#define SPRINT_WRONG_PENALTY_MS 3000
+#define BLITZ_MS 60000
+#define BLITZ_BONUS_MS 1000         // Won back for every correct answer
+#define BLITZ_STREAK_BONUS_MS 3000  // Extra on every 5 in a row
+#define SPEED_FEEDBACK_MS 600
+#define TIMER_BAR_X 20
+#define TIMER_BAR_Y 18
+#define TIMER_BAR_W 280
+#define TIMER_BAR_H 9
 
 // Backlight pin - GPIO 27 for CYD (not 21!)
 #define TFT_BACKLIGHT 27
 
+// Power management - idle timeouts, clocks and backlight levels
+#ifndef POWER_SAVE
+#define POWER_SAVE 1                // 0 disables light sleep (emulators, bring-up)
+#endif
+#define CPU_MHZ_ACTIVE 240
+#define CPU_MHZ_IDLE 80
+#define DIM_AFTER_MS 30000          // No touch for 30s - dim the backlight
+#define OFF_AFTER_MS 120000         // No touch for 2min - backlight off
+#define IDLE_WAKE_MS 1000           // Longest light sleep on a static screen
+#define BACKLIGHT_FULL 255
+#define BACKLIGHT_DIM 40
+#define BACKLIGHT_FADE_MS 400
+#define BACKLIGHT_CHANNEL LEDC_CHANNEL_0
+#define TOUCH_IRQ_PIN GPIO_NUM_36   // XPT2046 PENIRQ, low while touched
+
+// Touch sampling - pressure hysteresis keeps a light press from flickering
+#define TOUCH_Z_PRESS 300           // Pressure to count as a new press
+#define TOUCH_Z_RELEASE 200         // ...and to still count as held
+#define TOUCH_CAL_SAMPLES 16        // Accepted bursts averaged per target
+#define TOUCH_CAL_TIMEOUT_MS 10000
+#ifndef TOUCH_PANEL
+#define TOUCH_PANEL 1               // 0 never reads the XPT2046 - touches come from
+#endif                              // the serial 'tap'/'swipe' commands (emulators)
+#define SCRIPT_TAP_MS 80
+#ifndef GESTURE_LOG
+#define GESTURE_LOG 0               // 1 prints every recognized gesture on serial
+#endif
+#define SCRIPT_SWIPE_MS 250
+
+// Frame scheduling - physics at a fixed 60Hz step, render at most once per step
+#define FRAME_STEP_US 16667
+#define FRAME_BUDGET_US 16667
+#define MAX_PHYSICS_STEPS 4         // Catch-up cap after a long frame
+
+// Framebuffer - 1 draws the whole UI into a 4-bpp palette canvas (38 KB) that
+// is pushed to the panel in dirty bands; 0 draws straight to the panel
+#ifndef INDEXED_FRAMEBUFFER
+#define INDEXED_FRAMEBUFFER 0
+#endif
+
+// Display list - 1 records each frame's draw calls (10 KB) and sends them at
+// presentFrame() with covered calls dropped and same-color fills merged.
+// Direct drawing only - the framebuffer already sends each pixel once.
+#ifndef DISPLAY_LIST
+#define DISPLAY_LIST 0
+#endif
+#if DISPLAY_LIST && INDEXED_FRAMEBUFFER
+#error "DISPLAY_LIST and INDEXED_FRAMEBUFFER are alternatives - pick one"
+#endif
+
+// Bus profiler - TFT_PROFILER=1 (see TftProfiler.h) times every draw call
+// on the panel and charges it to the screen and TFT_PROFILE_SCOPE() stack
+// it came from. Measures direct drawing, so it stands alone.
+#if TFT_PROFILER && (INDEXED_FRAMEBUFFER || DISPLAY_LIST)
+#error "TFT_PROFILER measures direct drawing - build it without INDEXED_FRAMEBUFFER or DISPLAY_LIST"
+#endif
+
+// Sound - effects are mixed on core 0 and sent to the speaker (GPIO 26, the
+// built-in DAC) through I2S DMA, so the render loop on core 1 never waits
+#ifndef SOUND_ENABLED
+#define SOUND_ENABLED 1
+#endif
+#define SOUND_SAMPLE_RATE 16000
+#define SOUND_BLOCK_SAMPLES 256     // 16 ms per block
+#define SOUND_QUEUE_LEN 4
+
+// Pre-rendered screen layers are streamed this many lines at a time
+#define ASSET_BAND_LINES 8
+#define ASSET_BAND_PIXELS (SCREEN_WIDTH * ASSET_BAND_LINES)
+
+// Score trend of recent rounds, on the round-end and stats screens
+#define TREND_W 64
+#define TREND_H 40
+#define ROUND_END_TREND_X 248       // Right of the score box
+#define ROUND_END_TREND_Y 100
+#define STATS_TREND_X 190
+
+// Serial console
+#define SERIAL_LINE_MAX 48
+
+// Screenshots ('shot') - base64 lines of this many encoded bytes, and how
+// many frames in a row one command can capture
+#define SHOT_LINE_BYTES 57
+#define SHOT_MAX_FRAMES 16
+
+// Random numbers - 0 seeds from the hardware RNG at boot; anything else
+// replays the same questions and effects every boot ('rng seed' at runtime)
+#ifndef RNG_SEED
+#define RNG_SEED 0
+#endif
+
+// Screen fixtures - 1 adds every screen drawn from fixed state, for the
+// simulator's golden images ('fixture NAME'). Replaces the stats in RAM.
+#ifndef SCREEN_FIXTURES
+#define SCREEN_FIXTURES 0
+#endif
+
+// Boot - first interactive frame must land within this many ms of reset
+#define BOOT_BUDGET_MS 300
+#define MAX_BOOT_STAGES 8
+
+// Launcher - registered minigames, shown two per page
+#define MAX_GAMES 8
+#define GAMES_PER_PAGE 2
+
+// Child profiles - each one gets a Preferences namespace per operation
+// ("mq_p0".."md_p3", 16 in all). NVS budget per namespace, in 32-byte entries
+// (a blob is an index entry, a header entry and its data):
+//   namespace 1 + "stats" 36 B 4 + "facts" 288 B 11 + "rounds" 100 B 6 = 22
+// 16 x 22 = 352, plus 5 for "mathquiz" (profile, touch calibration) = 357 of
+// the 504 a 20 KB partition can use (huge_app.csv: 5 pages of 126, one kept
+// free), leaving a page spare for rewrites. Check it with 'nvs'.
+#define NUM_PROFILES 4
+
 // ============================================================================
 // COLOR PALETTE - Bright, kid-friendly colors!
 // ============================================================================
@@ -69,32 +241,64 @@ bool touchCalibrated = false;
 #define COLOR_BRONZE     0xBC40  // Bronze
 
 // Button colors (gradient effect)
-#define COLOR_BTN_1      0x03FF  // Cyan-ish
+#define COLOR_BTN_1      0x03EF  // Teal
 #define COLOR_BTN_2      0x07FF  // Cyan
 #define COLOR_BTN_3      0xFFE0  // Yellow
 #define COLOR_BTN_4      0xFD20  // Orange
 
+// Grays for disabled UI
+#define COLOR_GRAY       0x4208
+#define COLOR_LIGHT_GRAY 0x8410
+
+// The 16 colors the indexed framebuffer can hold, including the four answer
+// buttons. Anything else drawn while it is enabled snaps to the nearest
+// entry.
+const uint16_t uiPalette[CANVAS_PALETTE_SIZE] = {
+    COLOR_BG, COLOR_BG_LIGHT, COLOR_WHITE, COLOR_BLACK,
+    COLOR_RED, COLOR_ORANGE, COLOR_YELLOW, COLOR_GREEN,
+    COLOR_CYAN, COLOR_BLUE, COLOR_PURPLE, COLOR_PINK,
+    COLOR_GOLD, COLOR_BTN_1, COLOR_GRAY, COLOR_LIGHT_GRAY
+};
+#define PALETTE_BG_LIGHT 1   // Slot of the question box, stepped by the pulses
+
+// Correct/wrong feedback fades the question box toward the result color and
+// back - one table lookup per step, built at compile time (Color565.h)
+constexpr ColorFade correctPulse = makeColorFade(COLOR_BG_LIGHT, COLOR_CORRECT);
+constexpr ColorFade wrongPulse = makeColorFade(COLOR_BG_LIGHT, COLOR_WRONG);
+const uint8_t pulseSteps[] = {12, 24, 32, 20, 8, 0};
+
+// Added to a pressed answer button's color, clipping at white
+#define ANSWER_GLOW 0x4208
+
 // ============================================================================
 // OBJECTS
 // ============================================================================
 
-TFT_eSPI tft = TFT_eSPI();
+// The panel itself - init, touch and raw pixel pushes go here. Everything
+// else draws through tft, which is either the panel or the framebuffer.
+TFT_eSPI display = TFT_eSPI();
+#if INDEXED_FRAMEBUFFER
+IndexedCanvas canvas(&display);
+TFT_eSPI& tft = canvas;
+#elif DISPLAY_LIST
+DisplayList displayList(&display);
+TFT_eSPI& tft = displayList;
+#elif TFT_PROFILER
+TftProfiler profiledTft(&display);
+TFT_eSPI& tft = profiledTft;
+#else
+TFT_eSPI& tft = display;
+#endif
 Preferences prefs;
 
 // ============================================================================
 // GAME STATE
 // ============================================================================
 
-// Which minigame is currently active
-enum ActiveGame {
-    GAME_NONE,          // At launcher
-    GAME_MATHFACTS,     // Times table quiz
-    GAME_COMING_SOON    // Placeholder for future game
-};
-
 enum GameScreen {
     // Launcher screens
     SCREEN_LAUNCHER,
+    SCREEN_PARENT,
     // MathFacts screens
     SCREEN_SPLASH,
     SCREEN_MENU,
@@ -102,18 +306,59 @@ enum GameScreen {
     SCREEN_RESULT,
     SCREEN_ACHIEVEMENT,
     SCREEN_STATS,
-    SCREEN_ROUND_END
+    SCREEN_ROUND_END,
+    NUM_SCREENS
+};
+
+const char* const screenNames[NUM_SCREENS] = {
+    "launcher", "parent", "splash", "menu", "quiz", "result", "achievement", "stats", "round_end"
 };
 
-ActiveGame currentGame = GAME_NONE;
+// Events that drive screen transitions (see screenTransitions[])
+enum ScreenEvent {
+    EV_CONTINUE,        // Tap to continue
+    EV_BACK,
+    EV_PLAY,            // Start a new round
+    EV_SHOW_STATS,
+    EV_ANSWERED,        // Answer button pressed
+    EV_NEXT_QUESTION,
+    EV_ACHIEVEMENT,     // Unseen achievement waiting
+    EV_ROUND_DONE,
+    NUM_SCREEN_EVENTS
+};
 
-struct Question {
-    int num1;
-    int num2;
-    int correctAnswer;
-    int answers[ANSWERS_COUNT];
-    int correctIndex;
+// Boot timeline - stage timestamps in microseconds since reset
+struct BootStage {
+    const char* name;
+    int64_t us;
+};
+BootStage bootStages[MAX_BOOT_STAGES];
+int numBootStages = 0;
+bool bootFinished = false;
+
+// Power management
+enum PowerState {
+    PWR_ACTIVE,     // Animating - full clock, sleeps only between frames
+    PWR_IDLE,       // Static screen - low clock, sleeps until touch/timer
+    PWR_DIM,        // Idle a while - backlight dimmed
+    PWR_OFF,        // Idle a long while - backlight off
+    NUM_POWER_STATES
 };
+const char* const powerStateNames[NUM_POWER_STATES] = {"active", "idle", "dim", "off"};
+PowerState powerState = PWR_ACTIVE;
+bool frameAnimating = false;         // Set by anything that moves during a frame
+unsigned long lastActivityTime = 0;  // Last touch
+int64_t powerStateSinceUs = 0;
+int64_t powerResidencyUs[NUM_POWER_STATES] = {0};
+uint32_t powerSleeps[NUM_POWER_STATES] = {0};
+int64_t touchWakeUs = 0;             // When a touch last woke us from light sleep
+int64_t maxWakeLatencyUs = 0;        // Worst wake-to-first-frame seen
+
+// Minigame registry
+const Minigame* games[MAX_GAMES];
+int numGames = 0;
+const Minigame* activeGame = nullptr;   // nullptr while at the launcher
+int launcherPage = 0;
 
 struct GameStats {
     int totalCorrect;
@@ -123,10 +368,55 @@ struct GameStats {
     int perfectRounds;
     int questionsThisRound;
     int correctThisRound;
+    unsigned long answerMsThisRound;  // For the round's average answer time
     unsigned long fastestAnswer;  // in milliseconds
     int tablesCompleted;          // bitmask for tables 1-12
+    unsigned long sprintBestMs;   // Personal bests per speed mode (0 = none)
+    int blitzBest;
+};
+
+enum RoundMode {
+    MODE_CLASSIC,    // 10 questions, untimed
+    MODE_SPRINT,     // SPRINT_QUESTIONS against the clock
+    MODE_BLITZ,      // As many as possible in BLITZ_MS
+    NUM_ROUND_MODES
 };
 
+// Speed round clock. Time only accrues while a question is showing, so the
+// feedback screens never cost the player anything.
+struct SpeedClock {
+    int64_t elapsedUs;      // Question time banked so far
+    int64_t resumedUs;      // When the current question appeared (0 = paused)
+    int64_t adjustUs;       // Blitz: time won back. Sprint: penalties.
+    int barWidth;           // Timer bar fill currently on screen
+    uint16_t barColor;
+    bool newBest;
+};
+
+// Compact per-profile save record, written and read as one NVS blob.
+// Bump PROFILE_BLOB_VERSION whenever the layout changes.
+#define PROFILE_BLOB_VERSION 2
+#define PROFILE_BLOB_V1_SIZE 28     // Before personal bests - still loadable
+struct __attribute__((packed)) ProfileBlob {
+    uint8_t  version;
+    uint8_t  reserved;
+    uint16_t achieveBits;       // unlocked achievements
+    uint16_t shownBits;         // achievements whose popup was displayed
+    uint16_t tablesCompleted;   // bitmask for tables 1-12
+    uint32_t totalCorrect;
+    uint32_t totalWrong;
+    uint16_t currentStreak;
+    uint16_t bestStreak;
+    uint16_t perfectRounds;
+    uint16_t reserved2;
+    uint32_t fastestAnswer;     // in milliseconds
+    // Version 2
+    uint32_t sprintBestMs;      // Fastest sprint incl. penalties, 0 = none
+    uint16_t blitzBest;         // Most correct in a 60 second round
+    uint16_t reserved3;
+};
+static_assert(sizeof(ProfileBlob) == 36, "ProfileBlob layout changed - update the NVS budget");
+
 struct Achievement {
     const char* name;
     const char* icon;
@@ -136,20 +426,95 @@ struct Achievement {
 };
 
 // Global state
-GameScreen currentScreen = SCREEN_SPLASH;
+ScreenMachine<NUM_SCREENS, NUM_SCREEN_EVENTS> screens;
+#if DISPLAY_LIST
+// Per screen, since the last 'dlist reset'
+DisplayListCounters displayListStats[NUM_SCREENS];
+uint32_t displayListFrames[NUM_SCREENS];
+#endif
 Question currentQuestion;
+void (*generateFact)(Question& q) = nullptr;   // Set by the facts game being played
+const char* factsSubtitle = "";
 GameStats stats = {0};
-unsigned long questionStartTime = 0;
-unsigned long lastTouchTime = 0;
+FactMastery factMastery;         // Per fact, for the stats heatmap - saved with the stats
+RoundHistory roundHistory;       // Last ROUND_HISTORY_LEN rounds, newest last
+RoundSparkline roundTrend(TREND_H);
+int64_t questionStartUs = 0;
+RoundMode roundMode = MODE_CLASSIC;
+SpeedClock speedClock = {0};
+TouchFilter touchFilter;
+GestureRecognizer gestures;
+bool touchWakeOnly = false;      // This press woke the screen - ignore its gesture
+int statsPage = 0;               // 0 = stats, 1 = fact heatmap, then pages of achievements
+uint32_t touchSampleUs = 0;      // Total / worst time spent reading the panel
+uint32_t touchWorstUs = 0;
+uint32_t touchSamples = 0;
+
+// A touch typed on the serial console (or the desktop simulator's mouse),
+// played back in place of the panel
+struct ScriptedTouch {
+    int64_t startUs;                 // 0 = none playing
+    uint32_t durationUs;
+    int16_t x0, y0, x1, y1;          // Slides from the first point to the second
+    bool held;                       // Stays down at x1,y1 until released
+};
+ScriptedTouch scriptedTouch = {0};
 int selectedAnswer = -1;
-bool showingFeedback = false;
 bool lastAnswerCorrect = false;  // Track for redrawing feedback over confetti
 int feedbackMessageIndex = 0;    // Store which "AWESOME/GREAT/etc" message to show
+
+// One random stream per subsystem, so one never shifts another's sequence
+enum RngStream {
+    RNG_QUESTIONS,
+    RNG_FEEDBACK,
+    RNG_CONFETTI,
+    RNG_STARS,
+    RNG_DECOR,          // Reseeded to a constant on every use
+    NUM_RNG_STREAMS
+};
+const char* const rngStreamNames[NUM_RNG_STREAMS] = {"questions", "feedback", "confetti", "stars", "decor"};
+Rng rngs[NUM_RNG_STREAMS];
+uint32_t rngSeed = 0;
 unsigned long feedbackStartTime = 0;
+
+// Question box pulse after an answer, one step per frame (startQuestionPulse)
+const ColorFade* pulseFade = nullptr;   // nullptr - not pulsing
+uint8_t pulseStep = 0;                  // Steps drawn, over all the pulses
+uint8_t pulseStepCount = 0;
+uint16_t pulseStepMs = 0;
+unsigned long pulseNextMs = 0;
 int currentAchievementIndex = -1; // Track which achievement is being displayed
 
+// Profiles
+int activeProfile = 0;
+bool profileLoaded = false;      // Stats for activeProfile are in RAM
+const Minigame* loadedGame = nullptr;  // ...and for this game's save bucket
+const char* const profileNames[NUM_PROFILES] = {"PLAYER 1", "PLAYER 2", "PLAYER 3", "PLAYER 4"};
+const uint16_t profileColors[NUM_PROFILES] = {COLOR_GREEN, COLOR_CYAN, COLOR_PINK, COLOR_ORANGE};
+
+// Frame scheduling
+FrameScheduler frameScheduler(FRAME_STEP_US, FRAME_BUDGET_US, MAX_PHYSICS_STEPS);
+int physicsSteps = 1;                // Fixed steps to simulate this frame
+uint64_t frameCycles = 0;            // CPU cycles in frames since 'frames reset'
+uint32_t frameWorstCycles = 0;
+
+// Screenshots armed by 'shot N' / 'shot slow', and the encoded bytes
+// waiting to go out as the next base64 line
+int shotFramesLeft = 0;
+bool shotOnSlowFrame = false;
+uint8_t shotLine[SHOT_LINE_BYTES];
+int shotLineLen = 0;
+
+// Saves to NVS - count, bytes and time, for 'nvs'
+uint32_t nvsWrites = 0;
+uint32_t nvsWriteBytes = 0;
+uint32_t nvsWriteUs = 0;
+uint32_t nvsWorstUs = 0;
+uint32_t nvsFailures = 0;
+
 // Confetti particles
 #define MAX_CONFETTI 50
+#define MIN_CONFETTI 20              // Particles kept when shedding under load
 struct Confetti {
     float x, y;
     float vx, vy;
@@ -157,7 +522,7 @@ struct Confetti {
     bool active;
     int size;
 };
-Confetti confetti[MAX_CONFETTI];
+Confetti* confetti = nullptr;     // Allocated while Math Facts is running
 bool confettiActive = false;
 unsigned long confettiStartTime = 0;
 
@@ -171,7 +536,7 @@ struct Star {
     uint16_t color;
     bool active;
 };
-Star stars[MAX_STARS];
+Star* stars = nullptr;             // Allocated while Math Facts is running
 
 // Character state (little buddy in corner)
 struct Character {
@@ -188,8 +553,75 @@ struct Character {
 };
 Character buddy = {0, 0, 22, 300, false, false, false, 0, 0, 0};
 
+// Buddy poses, pre-rendered once into RGB565 sprites while Math Facts runs.
+// Pixels are stored in panel byte order (as TFT_eSprite leaves them) with
+// BUDDY_KEY marking transparency.
+#define BUDDY_W 25
+#define BUDDY_H 30
+#define BUDDY_ORIGIN_X 15            // Sprite pixel that sits on (buddy.x, y)
+#define BUDDY_ORIGIN_Y 15
+#define BUDDY_SCRATCH_H (BUDDY_H * 2)  // Tallest old+new window sent in one write
+#define BUDDY_KEY 0x0120
+enum BuddyPose {
+    POSE_IDLE,
+    POSE_HAPPY,      // Happy eyes - jumping after a correct answer
+    POSE_DEAD,
+    POSE_DANCE_A,
+    POSE_DANCE_B,
+    NUM_POSES
+};
+uint16_t* buddySprites = nullptr;    // NUM_POSES * BUDDY_W * BUDDY_H
+uint16_t* buddyScratch = nullptr;    // BUDDY_W * BUDDY_SCRATCH_H
+int buddyDrawnPose = -1;             // What is on the panel now (-1 = nothing)
+int buddyDrawnTop = 0;
+
+// Static screen backgrounds, pre-rendered by tools/make_assets.py
+enum ScreenLayer {
+    LAYER_SPLASH,
+    LAYER_MENU,
+    LAYER_ACHIEVEMENT,
+    LAYER_ROUND_END,
+    NUM_LAYERS
+};
+struct LayerInfo {
+    const char* name;
+    const RleImage* image;
+    uint32_t streamUs;       // Last time it was drawn from flash
+    uint32_t primitiveUs;    // Same layer from primitives ("layers bench")
+};
+LayerInfo layers[NUM_LAYERS] = {
+    {"splash", &assetSplash, 0, 0},
+    {"menu", &assetMenu, 0, 0},
+    {"achievement", &assetAchievement, 0, 0},
+    {"round_end", &assetRoundEnd, 0, 0}
+};
+uint16_t assetBands[2][ASSET_BAND_PIXELS];   // Decode one while DMA sends the other
+bool displayDma = false;
+
+// Anti-aliased fonts from tools/make_fonts.py and the glyphs blended so far
+SmoothFont questionFont;
+SmoothFont answerFont;
+SmoothFont titleFont;
+GlyphCache glyphCache;
+
 // Achievement definitions
 #define NUM_ACHIEVEMENTS 12
+#define ACHIEVEMENTS_PER_PAGE 6
+#define STATS_PAGES (2 + (NUM_ACHIEVEMENTS + ACHIEVEMENTS_PER_PAGE - 1) / ACHIEVEMENTS_PER_PAGE)
+
+// Fact heatmap on the second stats page: one cell per fact, a 1 px gap after
+#define HEATMAP_CELL 14
+#define HEATMAP_PITCH (HEATMAP_CELL + 1)
+#define HEATMAP_SIZE (HEATMAP_PITCH * FACT_RANGE)
+#define HEATMAP_X 40
+#define HEATMAP_Y 40
+#define HEATMAP_KEY_X 228
+const uint16_t masteryColors[NUM_MASTERY_LEVELS] = {
+    COLOR_GRAY, COLOR_RED, COLOR_ORANGE, COLOR_YELLOW, COLOR_CYAN, COLOR_GREEN
+};
+const char* const masteryNames[NUM_MASTERY_LEVELS] = {
+    "Not yet", "Weak", "Shaky", "Close", "Slow", "Mastered"
+};
 Achievement achievements[NUM_ACHIEVEMENTS] = {
     {"First Steps", "1", "Answer your first question!", false, false},
     {"Getting Started", "5", "Get 5 correct answers!", false, false},
@@ -205,6 +637,9 @@ Achievement achievements[NUM_ACHIEVEMENTS] = {
     {"Dedication", "D", "Get 50 correct in a row!", false, false}
 };
 
+const char* const roundModeNames[NUM_ROUND_MODES] = {"CLASSIC", "SPRINT", "60 SEC"};
+const uint16_t roundModeColors[NUM_ROUND_MODES] = {COLOR_GREEN, COLOR_CYAN, COLOR_ORANGE};
+
 // Rainbow colors array for effects
 const uint16_t rainbowColors[] = {
     COLOR_RED, COLOR_ORANGE, COLOR_YELLOW, COLOR_GREEN,
@@ -212,12 +647,41 @@ const uint16_t rainbowColors[] = {
 };
 #define NUM_RAINBOW_COLORS 8
 
+// Sound effects - a few notes each, synthesized by AudioMixer
+const SfxNote sfxCorrectNotes[] = {
+    {523, 60, WAVE_SQUARE, 110},    // C5
+    {659, 60, WAVE_SQUARE, 110},    // E5
+    {784, 140, WAVE_SQUARE, 130}    // G5
+};
+const SfxNote sfxWrongNotes[] = {
+    {196, 120, WAVE_SAW, 140},
+    {147, 220, WAVE_SAW, 140}
+};
+const SfxNote sfxJumpNotes[] = {
+    {440, 40, WAVE_TRIANGLE, 220},
+    {880, 70, WAVE_TRIANGLE, 220}
+};
+const SfxNote sfxAchievementNotes[] = {
+    {523, 90, WAVE_SQUARE, 110},
+    {659, 90, WAVE_SQUARE, 110},
+    {784, 90, WAVE_SQUARE, 110},
+    {1047, 90, WAVE_SQUARE, 120},
+    {0, 60, WAVE_SQUARE, 0},
+    {784, 80, WAVE_SQUARE, 110},
+    {1047, 300, WAVE_SQUARE, 140}
+};
+const Sfx sfxCorrect = {sfxCorrectNotes, sizeof(sfxCorrectNotes) / sizeof(SfxNote)};
+const Sfx sfxWrong = {sfxWrongNotes, sizeof(sfxWrongNotes) / sizeof(SfxNote)};
+const Sfx sfxJump = {sfxJumpNotes, sizeof(sfxJumpNotes) / sizeof(SfxNote)};
+const Sfx sfxAchievement = {sfxAchievementNotes, sizeof(sfxAchievementNotes) / sizeof(SfxNote)};
+
+AudioMixer mixer(SOUND_SAMPLE_RATE);   // Only touched by the sound task
+QueueHandle_t soundQueue = nullptr;    // const Sfx* from the main loop
+volatile bool soundBusy = false;       // Keeps light sleep off while playing
+
 // Button colors for answer options
 const uint16_t buttonColors[] = {
-    0x03EF,  // Teal
-    0x07FF,  // Cyan
-    0xFFE0,  // Yellow
-    0xFD20   // Orange
+    COLOR_BTN_1, COLOR_BTN_2, COLOR_BTN_3, COLOR_BTN_4
 };
 
 // ============================================================================
@@ -226,18 +690,42 @@ const uint16_t buttonColors[] = {
 
 // Launcher
 void drawLauncherScreen();
+void drawLauncherSlot(int slot);
+void registerGame(const Minigame* game);
+void registerFactsGames();
+void enterGame(int index);
+void leaveGame();
+void drawProfilePicker();
+void selectProfile(int profile);
+void resetProfileProgress(int profile);
 
 // MathFacts game screens
 void drawSplashScreen();
 void drawMenuScreen();
 void drawQuizScreen();
+void drawQuestionBox(uint16_t bg);
+void drawAnswerButton(int index, uint16_t color);
 void drawResultScreen(bool correct);
 void drawAchievementPopup(int achievementIndex);
 void redrawAchievementText(int achievementIndex);
 void drawStatsScreen();
+void drawStatsSummary();
+void drawAchievementList(int page);
+void drawTrend(int x, int y);
+void drawFactsPage();
+void fillHeatmapRows(uint16_t* out, int firstRow, int lines, const uint16_t* wireColors, uint16_t wireGap);
+void drawFactHeatmap(int x, int y);
+void drawPageDots(int page, int numPages);
+void drawParentScreen();
 void drawRoundEndScreen();
 void redrawRoundEndText();
+void drawRoundEndTrend();
 void drawCharacter();
+void blitCharacter();
+void initBuddySprites();
+void freeBuddySprites();
+void drawBuddyPose(TFT_eSPI &gfx, BuddyPose pose, int x, int y);
+BuddyPose currentBuddyPose();
 void updateCharacter();
 void buddyJump();
 void buddyDie();
@@ -247,577 +735,1504 @@ void checkAnswer(int answerIndex);
 void checkAchievements();
 void saveStats();
 void loadStats();
+void saveFactMastery();
+bool putBlob(const char* ns, const char* key, const void* data, size_t len);
+void reportNvs(const char* args);
+void recordRound();
+void loadActiveProfile();
+void profileNamespace(const char* prefix, int profile, char* out, size_t len);
+bool migrateLegacyStats(ProfileBlob &blob);
 
 void initConfetti();
-void updateConfetti();
+void eraseConfetti();
+void stepConfetti(bool shedExtra);
 void drawConfetti();
 void startConfetti();
 
 void initStars();
-void updateStars();
+void eraseStars();
+void stepStars();
 void drawStars();
 
+// Screen states
+void setupScreens();
+ScreenEvent nextAfterFeedback();
+void startRound();
+int roundLength();
+void quizEnter();
+void quizExit();
+void drawModePicker();
+void drawRoundEndTitle();
+void drawRoundEndScore();
+
+// Speed rounds
+void speedClockResume();
+void speedClockPause();
+int64_t speedElapsedUs();
+int64_t blitzRemainingUs();
+uint32_t sprintScoreMs();
+bool speedTimeUp();
+void finishSpeedRound();
+void drawTimerBar();
+void updateTimerBar();
+void timerBarValue(int &value, int &maxVal, uint16_t &color);
+bool updateEffects(unsigned long now);
+void animateBuddy();
+
 bool getTouchPoint(int &x, int &y);
-void handleTouch(int x, int y);
+bool sampleTouch();
+void handleGesture(const Gesture& g);
 void loadTouchCalibration();
 void saveTouchCalibration();
 void runTouchCalibration();
+void reportTouch(const char* args);
+void touchCalCommand(const char* args);
+bool scriptedTouchPoint(int &x, int &y);
+void playScriptedTouch(int x0, int y0, int x1, int y1, uint32_t ms);
+void pressScriptedTouch(int x, int y);
+void moveScriptedTouch(int x, int y);
+void releaseScriptedTouch();
+void tapCommand(const char* args);
+void swipeCommand(const char* args);
 void drawButton(int x, int y, int w, int h, uint16_t color, const char* text, int textSize);
 void drawRoundedRect(int x, int y, int w, int h, int r, uint16_t color);
 void fillRoundedRect(int x, int y, int w, int h, int r, uint16_t color);
-void drawProgressBar(int x, int y, int w, int h, int value, int maxVal, uint16_t color);
+int drawProgressBar(int x, int y, int w, int h, int value, int maxVal, uint16_t color);
+void updateProgressBar(int x, int y, int w, int h, int value, int maxVal, uint16_t color, int &drawnWidth);
 void drawCenteredText(const char* text, int y, int size, uint16_t color);
 void animateCorrect();
 void animateWrong();
-uint16_t dimColor(uint16_t color, float factor);
+void startQuestionPulse(const ColorFade& fade, int pulses, int stepMs);
+bool updateQuestionPulse(unsigned long now);
+void stopQuestionPulse();
+void pushWindow(int x, int y, int w, int h, uint16_t* pixels);
+void pushCachedWindow(int x, int y, int w, int h, const uint16_t* pixels);
+void presentFrame();
+#if DISPLAY_LIST
+void reportDisplayList(const char* args);
+#endif
+#if TFT_PROFILER
+const char* currentScreenName();
+void reportProfile(const char* args);
+#endif
+
+// Sound
+void soundBegin();
+void soundTask(void* arg);
+void playSfx(const Sfx& sfx);
+
+// Screen layers
+void drawLayer(ScreenLayer layer);
+void drawLayerPrimitives(ScreenLayer layer);
+void streamImage(const RleImage& image, int x, int y);
+void reportLayers(const char* args);
+
+// Screenshots
+int64_t captureScreen(const char* reason);
+void shotEmit(const uint8_t* bytes, size_t count);
+void shotSendLine();
+void shotAfterFrame();
+void shotCommand(const char* args);
+
+// Smooth text
+void smoothFontsBegin();
+int drawSmoothText(const SmoothFont& font, const char* text, int x, int y, uint16_t color, uint16_t bg);
+void drawSmoothCentered(const SmoothFont& font, const char* text, int y, uint16_t color, uint16_t bg);
+void drawTitle(const char* text, int y, uint16_t color, uint16_t bg);
+void reportFonts(const char* args);
+
+// Random numbers
+void seedRandom(uint32_t seed);
+void reportRng(const char* args);
+
+// Frame scheduling
+bool frameAllows(FramePriority priority);
+
+// Power
+void powerBegin();
+void setBacklight(uint8_t level, int fadeMs);
+void powerKeepAwake();
+bool powerUserActivity();
+void setPowerState(PowerState state);
+void powerIdle(int64_t frameDueInUs);
+void reportPower(const char* args);
+
+// Serial console
+void pollSerialCommands();
+void printHelp(const char* args);
+void reportFrames(const char* args);
+
+// Screen fixtures
+#if SCREEN_FIXTURES
+const char* screenFixtureName(int index);
+void loadScreenFixture(int index);
+void drawScreenFixture(int index);
+void fixtureCommand(const char* args);
+#endif
+
+// Boot
+void bootMark(const char* name);
+void finishBoot();
+void reportBoot();
 
 // ============================================================================
 // SETUP
 // ============================================================================
 
 void setup() {
+    bootMark("app_start");
     Serial.begin(115200);
-    delay(100);
-    Serial.println("\n=== Times Table Quiz ===");
-
-    // Initialize backlight on GPIO 27
-    pinMode(TFT_BACKLIGHT, OUTPUT);
-    digitalWrite(TFT_BACKLIGHT, HIGH);
-    Serial.println("Backlight ON (GPIO 27)");
 
     // Initialize display
-    tft.init();
-    tft.setRotation(1);  // Landscape mode
-
-    // Print TFT_eSPI driver info for debugging
-    Serial.print("TFT_eSPI ver: ");
-    Serial.println(TFT_ESPI_VERSION);
-    Serial.print("Display driver: ");
-    #if defined(ILI9341_DRIVER) || defined(ILI9341_2_DRIVER)
-    Serial.println("ILI9341");
-    #elif defined(ST7789_DRIVER)
-    Serial.println("ST7789");
-    #else
-    Serial.println("Unknown");
-    #endif
-    Serial.printf("Display size: %d x %d\n", tft.width(), tft.height());
+    display.init();
+    display.setRotation(1);  // Landscape mode
 
-    tft.fillScreen(COLOR_BG);
-    Serial.println("Display initialized");
+    // tft.init() switches the backlight (GPIO 27) on - hand it to the PWM
+    // at zero so the power-on GRAM garbage is never seen
+    powerBegin();
+    bootMark("display_init");
 
-    // Quick test - draw something visible
-    tft.fillScreen(TFT_BLUE);
-    tft.setTextColor(TFT_WHITE);
-    tft.setTextSize(2);
-    tft.setCursor(50, 100);
-    tft.println("Initializing...");
-    delay(500);
+#if INDEXED_FRAMEBUFFER
+    if (!canvas.begin(uiPalette)) {
+        Serial.println("ERROR: no RAM for the indexed framebuffer");
+    }
+#else
+    displayDma = display.initDMA();
+#endif
+#if DISPLAY_LIST
+    displayList.begin();
+#endif
+#if TFT_PROFILER
+    profiledTft.begin(currentScreenName);
+#endif
+
+    soundBegin();
+
+    // Only the profile index is read at boot - stats load lazily on game entry
+    loadActiveProfile();
+    bootMark("profile");
+
+    smoothFontsBegin();
+
+    // Register minigames - their assets load when entered, not here
+    setupScreens();
+    registerFactsGames();
+
+    // Single first paint of the launcher, then light it up
+    screens.start(SCREEN_LAUNCHER);
+    presentFrame();
+    setBacklight(BACKLIGHT_FULL, 0);
+    bootMark("first_frame");
+
+    // Everything else waits for finishBoot() on the first loop() pass
+}
 
-    // Use hardcoded touch calibration (known-good for CYD)
-    tft.setTouch(touchCalData);
-    Serial.printf("Touch calibration set: %d %d %d %d %d\n",
-        touchCalData[0], touchCalData[1], touchCalData[2], touchCalData[3], touchCalData[4]);
+// ============================================================================
+// MAIN LOOP
+// ============================================================================
 
-    // Initialize random seed
-    randomSeed(analogRead(34) + millis());
+void loop() {
+    if (!bootFinished) {
+        finishBoot();
+    }
 
-    // Load saved stats
-    loadStats();
+    unsigned long now = millis();
 
-    // Initialize effects
-    initConfetti();
-    initStars();
+    // Input first - it is never shed
+    int touchX = 0, touchY = 0;
+    bool pressed = getTouchPoint(touchX, touchY);
+    if (pressed && !gestures.active()) {
+        // A press on a dark screen only wakes it up
+        touchWakeOnly = !powerUserActivity();
+    }
+    Gesture gesture;
+    if (gestures.update(pressed, touchX, touchY, now, gesture) && !touchWakeOnly) {
+        handleGesture(gesture);
+    }
 
-    // Show launcher screen
-    currentGame = GAME_NONE;
-    currentScreen = SCREEN_LAUNCHER;
-    tft.fillScreen(COLOR_BG);
-    drawLauncherScreen();
+    // First frame after a touch woke us up
+    if (touchWakeUs != 0) {
+        int64_t latency = esp_timer_get_time() - touchWakeUs;
+        if (latency > maxWakeLatencyUs) maxWakeLatencyUs = latency;
+        touchWakeUs = 0;
+    }
+
+    // Fixed-timestep frame: simulate whole physics steps, then render once
+    int64_t nowUs = esp_timer_get_time();
+    bool framed = frameScheduler.due(nowUs);
+    uint32_t startCycles = 0;
+    if (framed) {
+        startCycles = ESP.getCycleCount();
+        physicsSteps = frameScheduler.beginFrame(nowUs, frameAnimating);
+        frameAnimating = false;
+        screens.update(now);
+    }
+
+    // Touch handlers and the frame both draw - send it all in one go. The
+    // flush is part of the frame's time: with a framebuffer or display list
+    // it is where the SPI transfer happens.
+    presentFrame();
+
+    if (framed) {
+        frameScheduler.endFrame(esp_timer_get_time());
 
-    Serial.println("Setup complete!");
+        // Cycles don't change with the CPU clock, and under QEMU -icount
+        // they are exact
+        uint32_t cycles = ESP.getCycleCount() - startCycles;
+        frameCycles += cycles;
+        if (cycles > frameWorstCycles) frameWorstCycles = cycles;
+
+        shotAfterFrame();
+    }
+
+    pollSerialCommands();
+
+    // Sleep until the next frame, touch or idle deadline
+    powerIdle(frameScheduler.untilDueUs(esp_timer_get_time()));
+}
+
+// True if there is budget left this frame for decorative work
+bool frameAllows(FramePriority priority) {
+    return frameScheduler.allow(priority, esp_timer_get_time());
 }
 
 // ============================================================================
-// MAIN LOOP
+// POWER MANAGEMENT
 // ============================================================================
+//
+// Residency per state is printed by the "power" serial command. Current per
+// state has to be measured on the board (USB power meter in series):
+//   active - 240 MHz, backlight full, light sleep only between frames
+//   idle   - 80 MHz, backlight full, light sleep until touch or 1s timer
+//   dim    - 80 MHz, backlight ~15%, light sleep
+//   off    - 80 MHz, backlight off, light sleep
+
+void powerBegin() {
+    // Backlight PWM clocked from RTC8M so it keeps running in light sleep
+    ledc_timer_config_t timer = {};
+    timer.speed_mode = LEDC_LOW_SPEED_MODE;
+    timer.duty_resolution = LEDC_TIMER_8_BIT;
+    timer.timer_num = LEDC_TIMER_0;
+    timer.freq_hz = 5000;
+    timer.clk_cfg = LEDC_USE_RTC8M_CLK;
+    ledc_timer_config(&timer);
+
+    ledc_channel_config_t channel = {};
+    channel.gpio_num = TFT_BACKLIGHT;
+    channel.speed_mode = LEDC_LOW_SPEED_MODE;
+    channel.channel = BACKLIGHT_CHANNEL;
+    channel.intr_type = LEDC_INTR_DISABLE;
+    channel.timer_sel = LEDC_TIMER_0;
+    channel.duty = 0;
+    ledc_channel_config(&channel);
+    ledc_fade_func_install(0);
+    esp_sleep_pd_config(ESP_PD_DOMAIN_RTC8M, ESP_PD_OPTION_ON);
+
+    // Wake from light sleep on touch (PENIRQ low) or serial input
+    gpio_wakeup_enable(TOUCH_IRQ_PIN, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    uart_set_wakeup_threshold(UART_NUM_0, 3);
+    esp_sleep_enable_uart_wakeup(0);
+
+    lastActivityTime = millis();
+    powerStateSinceUs = esp_timer_get_time();
+}
 
-void loop() {
-    static unsigned long lastUpdate = 0;
+// Hardware fade - the CPU is free (or asleep) while it runs
+void setBacklight(uint8_t level, int fadeMs) {
+    if (fadeMs > 0) {
+        ledc_set_fade_with_time(LEDC_LOW_SPEED_MODE, BACKLIGHT_CHANNEL, level, fadeMs);
+        ledc_fade_start(LEDC_LOW_SPEED_MODE, BACKLIGHT_CHANNEL, LEDC_FADE_NO_WAIT);
+    } else {
+        ledc_set_duty(LEDC_LOW_SPEED_MODE, BACKLIGHT_CHANNEL, level);
+        ledc_update_duty(LEDC_LOW_SPEED_MODE, BACKLIGHT_CHANNEL);
+    }
+}
+
+// Call from any per-frame work that changes pixels, so the next frame runs
+// at full clock on time
+void powerKeepAwake() {
+    frameAnimating = true;
+}
+
+// Returns false if the screen was dark, so the touch only wakes it
+bool powerUserActivity() {
+    lastActivityTime = millis();
+    bool visible = powerState != PWR_OFF;
+    if (powerState != PWR_ACTIVE) {
+        setPowerState(PWR_ACTIVE);
+    }
+    return visible;
+}
+
+void setPowerState(PowerState state) {
+    int64_t nowUs = esp_timer_get_time();
+    powerResidencyUs[powerState] += nowUs - powerStateSinceUs;
+    powerStateSinceUs = nowUs;
+
+    PowerState previous = powerState;
+    powerState = state;
+
+    setCpuFrequencyMhz(state == PWR_ACTIVE ? CPU_MHZ_ACTIVE : CPU_MHZ_IDLE);
+    if (state == PWR_DIM) {
+        setBacklight(BACKLIGHT_DIM, BACKLIGHT_FADE_MS);
+    } else if (state == PWR_OFF) {
+        setBacklight(0, BACKLIGHT_FADE_MS);
+    } else if (previous == PWR_DIM || previous == PWR_OFF) {
+        setBacklight(BACKLIGHT_FULL, 0);  // Waking up - no fade
+    }
+}
+
+void powerIdle(int64_t frameDueInUs) {
     unsigned long now = millis();
+    unsigned long idleFor = now - lastActivityTime;
 
-    // Update effects at 60fps
-    if (now - lastUpdate >= 16) {
-        lastUpdate = now;
+    PowerState target = frameAnimating ? PWR_ACTIVE : PWR_IDLE;
+    if (idleFor >= OFF_AFTER_MS) {
+        target = PWR_OFF;
+    } else if (idleFor >= DIM_AFTER_MS) {
+        target = PWR_DIM;
+    }
+    if (target != powerState) {
+        setPowerState(target);
+    }
 
-        if (confettiActive) {
-            updateConfetti();
-            drawConfetti();
+#if POWER_SAVE
+    // I2S stops in light sleep - stay up until the effect finishes
+    if (soundBusy) return;
+    // A scripted touch is only seen if it is sampled while it plays
+    if (scriptedTouch.startUs != 0) return;
+
+    // How long until something needs us
+    unsigned long wakeIn;
+    if (frameAnimating) {
+        wakeIn = frameDueInUs / 1000;
+    } else if (powerState == PWR_IDLE) {
+        wakeIn = min((unsigned long)IDLE_WAKE_MS, DIM_AFTER_MS - idleFor);
+    } else if (powerState == PWR_DIM) {
+        wakeIn = min((unsigned long)IDLE_WAKE_MS, OFF_AFTER_MS - idleFor);
+    } else {
+        wakeIn = IDLE_WAKE_MS;
+    }
+    if (wakeIn < 2) return;  // Not worth the sleep entry/exit cost
 
-            // Redraw feedback text that confetti may have erased
-            if (showingFeedback) {
-                drawResultScreen(lastAnswerCorrect);
-            }
+    Serial.flush();
+    esp_sleep_enable_timer_wakeup(wakeIn * 1000ULL);
+    esp_light_sleep_start();
+    powerSleeps[powerState]++;
 
-            // Stop confetti after 2 seconds
-            if (now - confettiStartTime > 2000) {
-                confettiActive = false;
-                // Redraw current screen to clean up
-                if (currentScreen == SCREEN_QUIZ) {
-                    if (showingFeedback) {
-                        drawQuizScreen();
-                        drawResultScreen(lastAnswerCorrect);
-                    } else {
-                        drawQuizScreen();
-                    }
-                }
-            }
-        }
+    if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO) {
+        touchWakeUs = esp_timer_get_time();
+        setCpuFrequencyMhz(CPU_MHZ_ACTIVE);  // Respond at full speed
+    }
+#endif
+}
 
-        if (currentScreen == SCREEN_ACHIEVEMENT) {
-            updateStars();
-            drawStars();
-            // Redraw text that stars may have erased
-            if (currentAchievementIndex >= 0) {
-                redrawAchievementText(currentAchievementIndex);
-            }
-        }
+void reportPower(const char* args) {
+    int64_t currentUs = esp_timer_get_time() - powerStateSinceUs;
 
-        // Update character animation on quiz screen
-        if (currentScreen == SCREEN_QUIZ) {
-            updateCharacter();
-            // Redraw character area to animate (smaller area for smaller character)
-            tft.fillRect(buddy.x - 15, buddy.baseY - 15, 25, 30, COLOR_BG);
-            drawCharacter();
-        }
+    Serial.printf("Power state: %s, CPU %d MHz\n", powerStateNames[powerState], getCpuFrequencyMhz());
+    for (int i = 0; i < NUM_POWER_STATES; i++) {
+        int64_t residencyUs = powerResidencyUs[i] + (i == powerState ? currentUs : 0);
+        Serial.printf("  %-7s %10.1f s  %8u sleeps\n", powerStateNames[i],
+                      residencyUs / 1e6, powerSleeps[i]);
+    }
+    Serial.printf("  worst wake-to-frame: %.2f ms\n", maxWakeLatencyUs / 1000.0);
+}
+
+// ============================================================================
+// SOUND
+// ============================================================================
+//
+// The main loop only posts effect pointers to a queue. The sound task on
+// core 0 owns the mixer: it drains the queue, mixes a block and hands it to
+// the I2S driver, which blocks it until a DMA buffer frees up. When nothing
+// is playing the task parks on the queue and I2S is stopped.
+
+void soundBegin() {
+#if SOUND_ENABLED
+    i2s_config_t config = {};
+    config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX | I2S_MODE_DAC_BUILT_IN);
+    config.sample_rate = SOUND_SAMPLE_RATE;
+    config.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+    config.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
+    config.communication_format = I2S_COMM_FORMAT_STAND_MSB;
+    config.dma_buf_count = 4;
+    config.dma_buf_len = SOUND_BLOCK_SAMPLES;
+    config.tx_desc_auto_clear = true;   // Underrun plays silence, not the last block
+
+    if (i2s_driver_install(I2S_NUM_0, &config, 0, nullptr) != ESP_OK) {
+        Serial.println("ERROR: I2S init failed - no sound");
+        return;
+    }
+    i2s_set_pin(I2S_NUM_0, nullptr);
+    i2s_set_dac_mode(I2S_DAC_CHANNEL_LEFT_EN);   // GPIO 26
+    i2s_stop(I2S_NUM_0);
 
-        // Update character dancing on round-end screen
-        if (currentScreen == SCREEN_ROUND_END) {
-            updateCharacter();
-            // Clear and redraw dancing character
-            tft.fillRect(buddy.x - 15, buddy.baseY - 15, 25, 30, COLOR_BG);
-            drawCharacter();
+    soundQueue = xQueueCreate(SOUND_QUEUE_LEN, sizeof(const Sfx*));
+    xTaskCreatePinnedToCore(soundTask, "sound", 2048, nullptr, 3, nullptr, 0);
+#endif
+}
 
-            // Redraw round-end text if confetti is active
-            if (confettiActive) {
-                redrawRoundEndText();
-            }
+void soundTask(void* arg) {
+    static int16_t mono[SOUND_BLOCK_SAMPLES];
+    static uint16_t frames[SOUND_BLOCK_SAMPLES * 2];
+    const Sfx* sfx;
+
+    for (;;) {
+        if (mixer.activeVoices() == 0) {
+            i2s_stop(I2S_NUM_0);
+            soundBusy = false;
+            xQueueReceive(soundQueue, &sfx, portMAX_DELAY);
+            soundBusy = true;
+            mixer.play(sfx);
+            i2s_start(I2S_NUM_0);
+        }
+        while (xQueueReceive(soundQueue, &sfx, 0) == pdTRUE) {
+            mixer.play(sfx);
         }
+
+        // The built-in DAC takes the top 8 bits of an unsigned sample, on
+        // both slots of each stereo frame
+        mixer.render(mono, SOUND_BLOCK_SAMPLES);
+        for (int i = 0; i < SOUND_BLOCK_SAMPLES; i++) {
+            uint16_t level = (uint16_t)(mono[i] + 0x8000);
+            frames[i * 2] = level;
+            frames[i * 2 + 1] = level;
+        }
+        size_t written;
+        i2s_write(I2S_NUM_0, frames, sizeof(frames), &written, portMAX_DELAY);
+    }
+}
+
+// Never blocks - if the queue is full the effect is dropped
+void playSfx(const Sfx& sfx) {
+    if (!soundQueue) return;
+    const Sfx* p = &sfx;
+    if (xQueueSend(soundQueue, &p, 0) == pdTRUE) {
+        soundBusy = true;
     }
+}
+
+// ============================================================================
+// SERIAL CONSOLE
+// ============================================================================
+
+struct SerialCommand {
+    const char* name;
+    void (*run)(const char* args);
+    const char* help;
+};
 
-    // Handle feedback timeout
-    if (showingFeedback && now - feedbackStartTime > 1500) {
-        showingFeedback = false;
+const SerialCommand serialCommands[] = {
+    {"help",  printHelp,   "list commands"},
+    {"power", reportPower, "power state residency and wake latency"},
+    {"frames", reportFrames, "frame budget overruns and shedding ('frames reset' clears)"},
+    {"layers", reportLayers, "screen layer size and draw time ('layers bench' compares with primitives)"},
+    {"touch", reportTouch, "touch calibration and sampling cost"},
+    {"fonts", reportFonts, "glyph cache use ('fonts bench' times smooth vs GLCD text)"},
+    {"rng", reportRng, "random seed and streams ('rng seed N' replays, 'rng bench' times it)"},
+#if DISPLAY_LIST
+    {"dlist", reportDisplayList, "draw calls culled/merged per screen ('dlist reset' clears)"},
+#endif
+#if TFT_PROFILER
+    {"prof", reportProfile, "bus time per draw site ('prof folded [bytes|pixels|txns]', 'prof reset')"},
+#endif
+    {"nvs", reportNvs, "saves to flash: count, bytes, time and NVS entries used"},
+    {"shot", shotCommand, "screenshot to serial ('shot N' the next N frames, 'shot slow' the next overrun)"},
+    {"touchcal", touchCalCommand, "run the 3-point touch calibration"},
+    {"tap", tapCommand, "'tap X Y [ms]' presses the screen at X,Y"},
+    {"swipe", swipeCommand, "'swipe X0 Y0 X1 Y1' drags from one point to the other"},
+#if SCREEN_FIXTURES
+    {"fixture", fixtureCommand, "'fixture NAME' draws a screen from fixed state (no name lists them)"},
+#endif
+};
+
+// Reads one line at a time without blocking; dispatches on the first word
+void pollSerialCommands() {
+    static char line[SERIAL_LINE_MAX];
+    static int len = 0;
 
-        // Check if we should show a newly unlocked achievement
-        for (int i = 0; i < NUM_ACHIEVEMENTS; i++) {
-            if (achievements[i].unlocked && !achievements[i].shown) {
-                // This achievement was just unlocked - show it!
-                achievements[i].shown = true;
-                currentAchievementIndex = i;
-                currentScreen = SCREEN_ACHIEVEMENT;
-                drawAchievementPopup(i);
-                initStars();
+    while (Serial.available()) {
+        char c = Serial.read();
+        if (c != '\n' && c != '\r') {
+            if (len < SERIAL_LINE_MAX - 1) line[len++] = c;
+            continue;
+        }
+        if (len == 0) continue;
+        line[len] = '\0';
+        len = 0;
+
+        char* args = strchr(line, ' ');
+        if (args) *args++ = '\0';
+        for (const SerialCommand& cmd : serialCommands) {
+            if (strcmp(line, cmd.name) == 0) {
+                cmd.run(args ? args : "");
                 return;
             }
         }
+        Serial.printf("Unknown command '%s' - try 'help'\n", line);
+    }
+}
 
-        // Check if round is complete (10 questions)
-        if (stats.questionsThisRound >= 10) {
-            currentScreen = SCREEN_ROUND_END;
-            drawRoundEndScreen();
-            return;
-        }
+void reportFrames(const char* args) {
+    if (strcmp(args, "reset") == 0) {
+        frameScheduler.resetStats();
+        frameCycles = 0;
+        frameWorstCycles = 0;
+        Serial.println("Frame stats cleared");
+        return;
+    }
 
-        // Generate next question
-        generateQuestion();
-        drawQuizScreen();
+    const FrameStats& fs = frameScheduler.getStats();
+    Serial.printf("Frames: %u, budget %u us\n", fs.frames, frameScheduler.budget());
+    Serial.printf("  overruns:      %u\n", fs.overruns);
+    Serial.printf("  shed jobs:     %u\n", fs.shed);
+    Serial.printf("  dropped steps: %u\n", fs.droppedSteps);
+    Serial.printf("  last / worst:  %u / %u us\n", fs.lastFrameUs, fs.worstFrameUs);
+    if (fs.frames > 0) {
+        Serial.printf("  cycles:        %u avg / %u worst\n",
+                      (uint32_t)(frameCycles / fs.frames), frameWorstCycles);
     }
+}
 
-    // Handle touch
-    int touchX, touchY;
-    if (getTouchPoint(touchX, touchY)) {
-        // Debounce
-        if (now - lastTouchTime > 300) {
-            lastTouchTime = now;
-            handleTouch(touchX, touchY);
-        }
+void printHelp(const char* args) {
+    for (const SerialCommand& cmd : serialCommands) {
+        Serial.printf("  %-8s %s\n", cmd.name, cmd.help);
     }
 }
 
 // ============================================================================
-// TOUCH HANDLING
+// BOOT TIMELINE
 // ============================================================================
 
-bool getTouchPoint(int &x, int &y) {
-    uint16_t touchX, touchY;
+void bootMark(const char* name) {
+    if (numBootStages < MAX_BOOT_STAGES) {
+        bootStages[numBootStages++] = {name, esp_timer_get_time()};
+    }
+}
 
-    // Use TFT_eSPI's built-in touch - returns true if touched
-    if (tft.getTouch(&touchX, &touchY, 300)) {
-        // Manual coordinate transformation for CYD ESP32-2432S028
-        // Observed touch ranges from screen corners:
-        //   tx: 8 (left) to 285 (right)
-        //   ty: 16 (top) to 229 (bottom)
-        // Direct mapping, no swap or inversion needed
+// Non-critical init, deferred until the launcher is already on screen
+void finishBoot() {
+    bootFinished = true;
 
-        int rawX = touchX;
-        int rawY = touchY;
+    // Logged so a round can be replayed with 'rng seed'
+    seedRandom(RNG_SEED ? RNG_SEED : esp_random());
+    bootMark("deferred");
 
-        // Map tx (left-to-right: 0-290) to display X (0-320)
-        x = map(rawX, 0, 290, 0, 320);
-        x = constrain(x, 0, 320);
+    Serial.println("\n=== Times Table Quiz ===");
+    Serial.printf("TFT_eSPI ver: %s, display %d x %d\n", TFT_ESPI_VERSION, display.width(), display.height());
+    Serial.printf("Random seed: %u\n", rngSeed);
+    loadTouchCalibration();
 
-        // Map ty (top-to-bottom: 10-235) to display Y (0-240)
-        y = map(rawY, 10, 235, 0, 240);
-        y = constrain(y, 0, 240);
+    reportBoot();
 
-        // Debug: show both raw and mapped coordinates
-        Serial.printf("Touch raw: tx=%d ty=%d -> mapped: x=%d y=%d\n", rawX, rawY, x, y);
+    // Holding the screen through power-on asks for a new touch calibration
+    if (TOUCH_PANEL && display.getTouchRawZ() > TOUCH_Z_PRESS) {
+        runTouchCalibration();
+        screens.redraw();
+    }
+}
 
-        return true;
+// Prints the boot timeline plus a one-line summary that tools can grep for:
+//   BOOT first_frame_ms=212.4 budget_ms=300 status=OK
+void reportBoot() {
+    Serial.println("Boot timeline (ms since reset):");
+    int64_t firstFrameUs = 0;
+    for (int i = 0; i < numBootStages; i++) {
+        int64_t deltaUs = bootStages[i].us - (i > 0 ? bootStages[i - 1].us : 0);
+        Serial.printf("  %-14s %8.1f  (+%.1f)\n", bootStages[i].name,
+                      bootStages[i].us / 1000.0, deltaUs / 1000.0);
+        if (strcmp(bootStages[i].name, "first_frame") == 0) {
+            firstFrameUs = bootStages[i].us;
+        }
     }
 
-    return false;
+    bool ok = firstFrameUs > 0 && firstFrameUs <= BOOT_BUDGET_MS * 1000LL;
+    Serial.printf("BOOT first_frame_ms=%.1f budget_ms=%d status=%s\n",
+                  firstFrameUs / 1000.0, BOOT_BUDGET_MS, ok ? "OK" : "OVER_BUDGET");
 }
 
-void loadTouchCalibration() {
-    prefs.begin("mathquiz", true);
-    touchCalibrated = prefs.getBool("touchCal", false);
-    if (touchCalibrated) {
-        touchCalData[0] = prefs.getUShort("cal0", 275);
-        touchCalData[1] = prefs.getUShort("cal1", 3620);
-        touchCalData[2] = prefs.getUShort("cal2", 264);
-        touchCalData[3] = prefs.getUShort("cal3", 3532);
-        touchCalData[4] = prefs.getUShort("cal4", 1);
-        Serial.printf("Loaded cal: %d %d %d %d %d\n",
-            touchCalData[0], touchCalData[1], touchCalData[2], touchCalData[3], touchCalData[4]);
+// ============================================================================
+// TOUCH HANDLING
+// ============================================================================
+
+// Reads the panel once: a pressure conversion, and only while pressed a
+// burst of coordinate conversions for the filter. Returns true while held.
+bool sampleTouch() {
+#if !TOUCH_PANEL
+    return false;
+#endif
+    int64_t start = esp_timer_get_time();
+
+    bool held = false;
+    uint16_t z = display.getTouchRawZ();
+    if (z > (touchFilter.pressed() ? TOUCH_Z_RELEASE : TOUCH_Z_PRESS)) {
+        uint16_t xs[TOUCH_BURST], ys[TOUCH_BURST];
+        for (int i = 0; i < TOUCH_BURST; i++) {
+            display.getTouchRaw(&xs[i], &ys[i]);
+        }
+        // A noisy burst keeps the last good point, if there is one
+        touchFilter.addBurst(xs, ys, TOUCH_BURST);
+        held = touchFilter.pressed();
+    } else {
+        touchFilter.release();
     }
-    prefs.end();
+
+    uint32_t us = esp_timer_get_time() - start;
+    touchSampleUs += us;
+    if (us > touchWorstUs) touchWorstUs = us;
+    touchSamples++;
+    return held;
 }
 
-void saveTouchCalibration() {
-    prefs.begin("mathquiz", false);
-    prefs.putBool("touchCal", true);
-    prefs.putUShort("cal0", touchCalData[0]);
-    prefs.putUShort("cal1", touchCalData[1]);
-    prefs.putUShort("cal2", touchCalData[2]);
-    prefs.putUShort("cal3", touchCalData[3]);
-    prefs.putUShort("cal4", touchCalData[4]);
-    prefs.end();
-    touchCalibrated = true;
-    Serial.printf("Saved cal: %d %d %d %d %d\n",
-        touchCalData[0], touchCalData[1], touchCalData[2], touchCalData[3], touchCalData[4]);
+bool getTouchPoint(int &x, int &y) {
+    if (scriptedTouch.startUs != 0) return scriptedTouchPoint(x, y);
+    if (!sampleTouch()) return false;
+
+    touchMap(touchCal, touchFilter.rawX(), touchFilter.rawY(), x, y);
+    x = constrain(x, 0, SCREEN_WIDTH - 1);
+    y = constrain(y, 0, SCREEN_HEIGHT - 1);
+    return true;
 }
 
-void runTouchCalibration() {
-    tft.fillScreen(TFT_BLACK);
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    tft.setTextSize(2);
+// Where the scripted touch is now; false once it has ended, which the
+// gesture recognizer sees as the release
+bool scriptedTouchPoint(int &x, int &y) {
+    if (scriptedTouch.held) {
+        x = scriptedTouch.x1;
+        y = scriptedTouch.y1;
+        return true;
+    }
+    int64_t elapsed = esp_timer_get_time() - scriptedTouch.startUs;
+    if (elapsed >= scriptedTouch.durationUs) {
+        scriptedTouch.startUs = 0;
+        return false;
+    }
+    x = scriptedTouch.x0 + (scriptedTouch.x1 - scriptedTouch.x0) * elapsed / scriptedTouch.durationUs;
+    y = scriptedTouch.y0 + (scriptedTouch.y1 - scriptedTouch.y0) * elapsed / scriptedTouch.durationUs;
+    return true;
+}
 
-    tft.setCursor(20, 50);
-    tft.println("TOUCH CALIBRATION");
-    tft.setCursor(20, 80);
-    tft.println("Touch the screen");
-    tft.setCursor(20, 110);
-    tft.println("to begin...");
+void playScriptedTouch(int x0, int y0, int x1, int y1, uint32_t ms) {
+    scriptedTouch.x0 = constrain(x0, 0, SCREEN_WIDTH - 1);
+    scriptedTouch.y0 = constrain(y0, 0, SCREEN_HEIGHT - 1);
+    scriptedTouch.x1 = constrain(x1, 0, SCREEN_WIDTH - 1);
+    scriptedTouch.y1 = constrain(y1, 0, SCREEN_HEIGHT - 1);
+    scriptedTouch.durationUs = (ms > 0 ? ms : 1) * 1000;
+    scriptedTouch.startUs = esp_timer_get_time();
+    scriptedTouch.held = false;
+}
 
-    // Wait for a real touch (not phantom touch)
-    // If we're getting constant touches, that's a bad sign
-    int phantomCount = 0;
-    int noTouchCount = 0;
-    uint16_t tx, ty;
+// A press that lasts until releaseScriptedTouch() - the simulator's mouse
+void pressScriptedTouch(int x, int y) {
+    playScriptedTouch(x, y, x, y, 0);
+    scriptedTouch.held = true;
+}
+
+void moveScriptedTouch(int x, int y) {
+    if (!scriptedTouch.held) return;
+    scriptedTouch.x1 = constrain(x, 0, SCREEN_WIDTH - 1);
+    scriptedTouch.y1 = constrain(y, 0, SCREEN_HEIGHT - 1);
+}
 
-    Serial.println("Waiting for touch to stabilize...");
+// Stays down one more frame step, so a click that comes and goes between
+// two loop() passes is still seen as a press before the release
+void releaseScriptedTouch() {
+    if (!scriptedTouch.held) return;
+    scriptedTouch.held = false;
+    scriptedTouch.x0 = scriptedTouch.x1;
+    scriptedTouch.y0 = scriptedTouch.y1;
+    scriptedTouch.durationUs = esp_timer_get_time() - scriptedTouch.startUs + FRAME_STEP_US;
+}
 
-    for (int i = 0; i < 100; i++) {
-        if (tft.getTouch(&tx, &ty, 300)) {
-            phantomCount++;
-        } else {
-            noTouchCount++;
-        }
-        delay(20);
+void tapCommand(const char* args) {
+    int x, y;
+    unsigned ms = SCRIPT_TAP_MS;
+    if (sscanf(args, "%d %d %u", &x, &y, &ms) < 2) {
+        Serial.println("Usage: tap X Y [ms]");
+        return;
     }
+    playScriptedTouch(x, y, x, y, ms);
+}
 
-    Serial.printf("Touch check: %d phantom, %d no-touch\n", phantomCount, noTouchCount);
-
-    // If we got constant phantom touches, touch is broken - use defaults
-    if (phantomCount > 80) {
-        Serial.println("ERROR: Touch appears broken (constant phantom touches)");
-        Serial.println("Using default calibration values");
-        tft.fillScreen(TFT_BLACK);
-        tft.setCursor(20, 80);
-        tft.println("Touch error!");
-        tft.setCursor(20, 110);
-        tft.println("Using defaults...");
-        delay(2000);
-
-        // Use hardcoded defaults for CYD
-        touchCalData[0] = 300;
-        touchCalData[1] = 3600;
-        touchCalData[2] = 300;
-        touchCalData[3] = 3600;
-        touchCalData[4] = 1;
-        saveTouchCalibration();
-        tft.setTouch(touchCalData);
+void swipeCommand(const char* args) {
+    int x0, y0, x1, y1;
+    if (sscanf(args, "%d %d %d %d", &x0, &y0, &x1, &y1) < 4) {
+        Serial.println("Usage: swipe X0 Y0 X1 Y1");
         return;
     }
+    playScriptedTouch(x0, y0, x1, y1, SCRIPT_SWIPE_MS);
+}
+
+void loadTouchCalibration() {
+    prefs.begin("mathquiz", true);
+    TouchCalibration saved;
+    if (prefs.getBytesLength("touchAff") == sizeof(saved) &&
+        prefs.getBytes("touchAff", &saved, sizeof(saved)) == sizeof(saved)) {
+        touchCal = saved;
+        touchCalibrated = true;
+    }
+    prefs.end();
+    Serial.printf("Touch calibration: %s\n", touchCalibrated ? "saved" : "default");
+}
 
-    // Now wait for user to actually touch
-    tft.fillScreen(TFT_BLACK);
-    tft.setCursor(20, 80);
-    tft.println("Touch screen NOW");
-    tft.setCursor(20, 110);
-    tft.println("to calibrate...");
+void saveTouchCalibration() {
+    putBlob("mathquiz", "touchAff", &touchCal, sizeof(touchCal));
+    touchCalibrated = true;
+    Serial.printf("Saved touch calibration: x = %d %d %d, y = %d %d %d (Q16)\n",
+                  touchCal.ax, touchCal.bx, touchCal.cx, touchCal.ay, touchCal.by, touchCal.cy);
+}
 
-    // Wait for touch
+// Waits for a press on the target and returns its filtered raw position.
+// False on timeout.
+bool readCalibrationTarget(int x, int y, int32_t raw[2]) {
+    display.fillScreen(TFT_BLACK);
+    display.setTextColor(TFT_WHITE, TFT_BLACK);
+    display.setTextSize(2);
+    display.setCursor(20, 100);
+    display.println("Touch the cross");
+    display.drawFastHLine(x - 10, y, 21, TFT_MAGENTA);
+    display.drawFastVLine(x, y - 10, 21, TFT_MAGENTA);
+    display.drawCircle(x, y, 4, TFT_MAGENTA);
+
+    touchFilter.release();
+    int accepted = 0;
     unsigned long startWait = millis();
-    while (!tft.getTouch(&tx, &ty, 300)) {
-        if (millis() - startWait > 10000) {
-            // Timeout - use defaults
-            Serial.println("Calibration timeout, using defaults");
-            touchCalData[0] = 300;
-            touchCalData[1] = 3600;
-            touchCalData[2] = 300;
-            touchCalData[3] = 3600;
-            touchCalData[4] = 1;
-            saveTouchCalibration();
-            tft.setTouch(touchCalData);
-            return;
+    while (accepted < TOUCH_CAL_SAMPLES) {
+        if (millis() - startWait > TOUCH_CAL_TIMEOUT_MS) return false;
+        uint32_t before = touchFilter.acceptedBursts();
+        if (sampleTouch() && touchFilter.acceptedBursts() != before) {
+            accepted++;
+        } else if (!touchFilter.pressed()) {
+            accepted = 0;   // Lifted too early - start over
         }
-        delay(10);
+        delay(5);
     }
+    raw[0] = touchFilter.rawX();
+    raw[1] = touchFilter.rawY();
+    display.fillCircle(x, y, 6, TFT_GREEN);
 
     // Wait for release
-    while (tft.getTouch(&tx, &ty, 300)) {
+    while (sampleTouch()) {
         delay(10);
     }
-    delay(500);
-
-    tft.fillScreen(TFT_BLACK);
-    tft.setCursor(20, 50);
-    tft.println("Touch the arrows");
-    tft.setCursor(20, 80);
-    tft.println("in each corner");
-    delay(1500);
-
-    // Run TFT_eSPI calibration - user touches 4 corners
-    tft.calibrateTouch(touchCalData, TFT_MAGENTA, TFT_BLACK, 15);
+    delay(300);
+    return true;
+}
 
-    // Save calibration
-    saveTouchCalibration();
+// Three targets spread over the panel, as far from a line as they can be
+void runTouchCalibration() {
+    static const int32_t targets[TOUCH_CAL_POINTS][2] = {
+        {32, 24}, {288, 120}, {160, 216}
+    };
+
+    display.fillScreen(TFT_BLACK);
+    display.setTextColor(TFT_WHITE, TFT_BLACK);
+    display.setTextSize(2);
+    display.setCursor(20, 50);
+    display.println("TOUCH CALIBRATION");
+    display.setCursor(20, 80);
+    display.println("Let go of the screen");
+
+    // A panel that reads as pressed the whole time is faulty - keep what we have
+    int phantomCount = 0;
+    for (int i = 0; i < 100; i++) {
+        if (display.getTouchRawZ() > TOUCH_Z_PRESS) phantomCount++;
+        delay(20);
+    }
+    Serial.printf("Touch check: %d/100 phantom\n", phantomCount);
+
+    bool ok = phantomCount <= 80;
+    int32_t raw[TOUCH_CAL_POINTS][2] = {};
+    for (int i = 0; ok && i < TOUCH_CAL_POINTS; i++) {
+        ok = readCalibrationTarget(targets[i][0], targets[i][1], raw[i]);
+        if (ok) Serial.printf("Target %d (%d, %d): raw %d %d\n", i,
+                              targets[i][0], targets[i][1], raw[i][0], raw[i][1]);
+    }
 
-    // Apply calibration
-    tft.setTouch(touchCalData);
+    TouchCalibration fitted;
+    ok = ok && touchSolve(raw, targets, fitted);
 
-    tft.fillScreen(TFT_BLACK);
-    tft.setCursor(40, 100);
-    tft.println("Calibration saved!");
+    display.fillScreen(TFT_BLACK);
+    display.setCursor(40, 100);
+    if (ok) {
+        touchCal = fitted;
+        saveTouchCalibration();
+        display.println("Calibration saved!");
+    } else {
+        Serial.println("Touch calibration failed, keeping the current one");
+        display.println("Calibration failed");
+    }
+    touchFilter.release();
     delay(1500);
 }
 
-void handleTouch(int x, int y) {
-    Serial.printf("Touch at (%d, %d) - Screen: %d\n", x, y, currentScreen);
-
-    switch (currentScreen) {
-        case SCREEN_LAUNCHER:
-            // Math Facts button (y: 75-145)
-            if (y >= 75 && y <= 145) {
-                currentGame = GAME_MATHFACTS;
-                currentScreen = SCREEN_SPLASH;
-                drawSplashScreen();
-            }
-            // Coming Soon button - do nothing or show message
-            else if (y >= 160 && y <= 230) {
-                // Flash the button to show it was pressed but unavailable
-                fillRoundedRect(30, 160, 260, 70, 15, 0x5ACB);  // Slightly lighter gray
-                delay(100);
-                fillRoundedRect(30, 160, 260, 70, 15, 0x4208);  // Back to gray
-                tft.setTextSize(2);
-                drawCenteredText("COMING SOON", 180, 2, 0x8410);
-                tft.setTextSize(1);
-                drawCenteredText("More games on the way!", 205, 1, 0x6B4D);
-            }
-            break;
-
-        case SCREEN_SPLASH:
-            currentScreen = SCREEN_MENU;
-            drawMenuScreen();
-            break;
+void touchCalCommand(const char* args) {
+    runTouchCalibration();
+    screens.redraw();
+}
 
-        case SCREEN_MENU:
-            // Back button (top-left area)
-            if (x < 60 && y < 30) {
-                currentGame = GAME_NONE;
-                currentScreen = SCREEN_LAUNCHER;
-                drawLauncherScreen();
-            }
-            // "Play" button area (center of screen)
-            else if (y >= 80 && y <= 160) {
-                stats.questionsThisRound = 0;
-                stats.correctThisRound = 0;
-                generateQuestion();
-                currentScreen = SCREEN_QUIZ;
-                drawQuizScreen();
-            }
-            // "Stats" button area (bottom)
-            else if (y >= 180 && y <= 230) {
-                currentScreen = SCREEN_STATS;
-                drawStatsScreen();
-            }
-            break;
+void reportTouch(const char* args) {
+    Serial.printf("Touch calibration (%s): x = %d %d %d, y = %d %d %d (Q16)\n",
+                  touchCalibrated ? "saved" : "default",
+                  touchCal.ax, touchCal.bx, touchCal.cx, touchCal.ay, touchCal.by, touchCal.cy);
+    Serial.printf("  bursts: %u accepted, %u rejected\n",
+                  touchFilter.acceptedBursts(), touchFilter.rejectedBursts());
+    if (touchSamples > 0) {
+        Serial.printf("  sample cost: %u us avg, %u us worst\n",
+                      touchSampleUs / touchSamples, touchWorstUs);
+    }
+}
 
-        case SCREEN_QUIZ:
-            if (!showingFeedback) {
-                // Check which answer button was pressed
-                // Buttons are in 2x2 grid
-                int btnWidth = 145;
-                int btnHeight = 55;
-                int startX = 10;
-                int startY = 130;
-                int gapX = 10;
-                int gapY = 10;
-
-                Serial.printf("Checking buttons at touch (%d,%d)\n", x, y);
-
-                for (int i = 0; i < 4; i++) {
-                    int col = i % 2;
-                    int row = i / 2;
-                    int btnX = startX + col * (btnWidth + gapX);
-                    int btnY = startY + row * (btnHeight + gapY);
-
-                    Serial.printf("  Btn %d: x=%d-%d, y=%d-%d\n", i, btnX, btnX+btnWidth, btnY, btnY+btnHeight);
-
-                    if (x >= btnX && x <= btnX + btnWidth &&
-                        y >= btnY && y <= btnY + btnHeight) {
-                        Serial.printf("  -> MATCH! Selecting answer %d\n", i);
-                        checkAnswer(i);
-                        break;
-                    }
-                }
-            }
-            break;
+// The screen gets first refusal; anything but a swipe that it doesn't claim
+// is a touch where the press started, so a held or wobbly press still answers
+void handleGesture(const Gesture& g) {
+#if GESTURE_LOG
+    static const char* const names[] = {"tap", "double-tap", "long-press", "swipe", "drag"};
+    Serial.printf("Gesture %s at (%d, %d) d=(%d, %d) v=(%d, %d) - Screen: %d\n",
+                  names[g.type], g.x, g.y, g.dx, g.dy, g.vx, g.vy, screens.state());
+#endif
+
+    if (screens.gesture(g)) return;
+    if (g.type != GESTURE_SWIPE) {
+        screens.touch(g.x, g.y);
+    }
+}
 
-        case SCREEN_RESULT:
-            currentScreen = SCREEN_QUIZ;
-            generateQuestion();
-            drawQuizScreen();
-            break;
+// ============================================================================
+// SCREEN STATES
+// ============================================================================
 
-        case SCREEN_ACHIEVEMENT:
-            currentScreen = SCREEN_QUIZ;
-            generateQuestion();
-            drawQuizScreen();
-            break;
+// --- Launcher ---
 
-        case SCREEN_STATS:
-            // Back button (top left area)
-            if (x < 80 && y < 50) {
-                currentScreen = SCREEN_MENU;
-                drawMenuScreen();
-            }
-            break;
+void launcherEnter() {
+    leaveGame();
+}
 
-        case SCREEN_ROUND_END:
-            // Tap anywhere to start next round
-            stats.questionsThisRound = 0;
-            stats.correctThisRound = 0;
-            buddy.dead = false;  // Revive character for new round
-            buddy.dancing = false;  // Stop dancing
-            buddy.y = 0;
-            currentScreen = SCREEN_QUIZ;
-            generateQuestion();
-            drawQuizScreen();
-            break;
+void turnLauncherPage(int delta) {
+    int numPages = (numGames + GAMES_PER_PAGE - 1) / GAMES_PER_PAGE;
+    int page = constrain(launcherPage + delta, 0, max(numPages - 1, 0));
+    if (page != launcherPage) {
+        launcherPage = page;
+        drawLauncherScreen();
     }
 }
 
-// ============================================================================
-// QUESTION GENERATION
-// ============================================================================
+// Swipes page through games; a long press opens the parent menu
+bool launcherGesture(const Gesture& g) {
+    if (g.type == GESTURE_LONG_PRESS) {
+        screens.go(SCREEN_PARENT);
+        return true;
+    }
+    if (g.type == GESTURE_SWIPE && g.direction == SWIPE_LEFT) {
+        turnLauncherPage(1);
+        return true;
+    }
+    if (g.type == GESTURE_SWIPE && g.direction == SWIPE_RIGHT) {
+        turnLauncherPage(-1);
+        return true;
+    }
+    return false;
+}
 
-void generateQuestion() {
-    // Random numbers from 1-12
-    currentQuestion.num1 = random(MIN_TABLE, MAX_TABLE + 1);
-    currentQuestion.num2 = random(MIN_TABLE, MAX_TABLE + 1);
-    currentQuestion.correctAnswer = currentQuestion.num1 * currentQuestion.num2;
-
-    // Generate wrong answers that are plausible
-    int wrongAnswers[10];
-    int wrongCount = 0;
-
-    // Add some near-miss answers
-    if (currentQuestion.correctAnswer > 1) {
-        wrongAnswers[wrongCount++] = currentQuestion.correctAnswer - 1;
-        wrongAnswers[wrongCount++] = currentQuestion.correctAnswer + 1;
-    }
-    if (currentQuestion.correctAnswer > 2) {
-        wrongAnswers[wrongCount++] = currentQuestion.correctAnswer - 2;
-        wrongAnswers[wrongCount++] = currentQuestion.correctAnswer + 2;
-    }
-
-    // Add answers from adjacent tables
-    wrongAnswers[wrongCount++] = currentQuestion.num1 * (currentQuestion.num2 + 1);
-    wrongAnswers[wrongCount++] = currentQuestion.num1 * (currentQuestion.num2 - 1);
-    wrongAnswers[wrongCount++] = (currentQuestion.num1 + 1) * currentQuestion.num2;
-    wrongAnswers[wrongCount++] = (currentQuestion.num1 - 1) * currentQuestion.num2;
-
-    // Shuffle wrong answers
-    for (int i = wrongCount - 1; i > 0; i--) {
-        int j = random(0, i + 1);
-        int temp = wrongAnswers[i];
-        wrongAnswers[i] = wrongAnswers[j];
-        wrongAnswers[j] = temp;
-    }
-
-    // Place correct answer randomly
-    currentQuestion.correctIndex = random(0, ANSWERS_COUNT);
-
-    // Fill answer array
-    int wrongIdx = 0;
-    for (int i = 0; i < ANSWERS_COUNT; i++) {
-        if (i == currentQuestion.correctIndex) {
-            currentQuestion.answers[i] = currentQuestion.correctAnswer;
+void launcherTouch(int x, int y) {
+    // Profile picker chips (y: 44-70)
+    if (y >= 44 && y <= 70) {
+        int chip = (x - 20) / 72;
+        if (x >= 20 && chip < NUM_PROFILES) {
+            selectProfile(chip);
+        }
+    }
+    // Page arrows in the side margins
+    else if (y >= 75 && x < 28) {
+        turnLauncherPage(-1);
+    }
+    else if (y >= 75 && x > 292) {
+        turnLauncherPage(1);
+    }
+    // Game slots (y: 75-145 and 160-230)
+    else if ((y >= 75 && y <= 145) || (y >= 160 && y <= 230)) {
+        int slot = (y >= 160) ? 1 : 0;
+        int index = launcherPage * GAMES_PER_PAGE + slot;
+        if (index < numGames) {
+            enterGame(index);
         } else {
-            // Make sure we don't duplicate answers
-            int answer;
-            bool valid;
-            do {
-                valid = true;
-                answer = wrongAnswers[wrongIdx++ % wrongCount];
-
-                // Check it's not the correct answer
-                if (answer == currentQuestion.correctAnswer) valid = false;
-                if (answer <= 0) valid = false;
-
-                // Check it's not already used
-                for (int j = 0; j < i; j++) {
-                    if (currentQuestion.answers[j] == answer) valid = false;
-                }
-            } while (!valid && wrongIdx < 20);
-
-            currentQuestion.answers[i] = answer;
+            // Empty slot - flash to show it was pressed but unavailable
+            int slotY = 75 + slot * 85;
+            fillRoundedRect(30, slotY, 260, 70, 15, 0x5ACB);  // Slightly lighter gray
+            presentFrame();
+            delay(100);
+            drawLauncherSlot(slot);
         }
     }
+}
 
-    questionStartTime = millis();
-    stats.questionsThisRound++;
+// --- Parent menu (long press on the launcher) ---
 
-    Serial.printf("Question: %d x %d = %d (index %d)\n",
-                  currentQuestion.num1, currentQuestion.num2,
-                  currentQuestion.correctAnswer, currentQuestion.correctIndex);
+void parentTouch(int x, int y) {
+    // Back button or the BACK bar
+    if ((x < 80 && y < 30) || (y >= 190 && y <= 230)) {
+        screens.go(SCREEN_LAUNCHER);
+    }
+    else if (y >= 45 && y <= 95) {
+        runTouchCalibration();
+        screens.redraw();
+    }
+    // A single tap on reset only points at the double tap
+    else if (y >= 110 && y <= 160) {
+        drawCenteredText("Double-tap to reset", 167, 1, COLOR_YELLOW);
+    }
 }
 
-// ============================================================================
-// ANSWER CHECKING
-// ============================================================================
+bool parentGesture(const Gesture& g) {
+    if (g.type == GESTURE_DOUBLE_TAP && g.y >= 110 && g.y <= 160) {
+        resetProfileProgress(activeProfile);
+        tft.fillRect(0, 165, SCREEN_WIDTH, 12, COLOR_BG);
+        drawCenteredText("Progress cleared", 167, 1, COLOR_GREEN);
+        return true;
+    }
+    if (g.type == GESTURE_SWIPE && g.direction == SWIPE_RIGHT) {
+        screens.go(SCREEN_LAUNCHER);
+        return true;
+    }
+    return false;
+}
+
+// --- Splash / menu / stats ---
+
+void splashTouch(int x, int y) {
+    screens.fire(EV_CONTINUE);
+}
+
+void menuTouch(int x, int y) {
+    // Back button (top-left area)
+    if (x < 60 && y < 30) {
+        screens.fire(EV_BACK);
+    }
+    // Mode chips (y: 46-74)
+    else if (y >= 46 && y <= 74) {
+        int mode = constrain((x - 20) / 97, 0, NUM_ROUND_MODES - 1);
+        if (mode != roundMode) {
+            roundMode = (RoundMode)mode;
+            screens.redraw();
+        }
+    }
+    // "Play" button area (center of screen)
+    else if (y >= 80 && y <= 160) {
+        startRound();
+        screens.fire(EV_PLAY);
+    }
+    // "Stats" button area (bottom)
+    else if (y >= 180 && y <= 230) {
+        screens.fire(EV_SHOW_STATS);
+    }
+}
+
+void statsEnter() {
+    statsPage = 0;
+}
+
+void turnStatsPage(int delta) {
+    int page = constrain(statsPage + delta, 0, STATS_PAGES - 1);
+    if (page != statsPage) {
+        statsPage = page;
+        drawStatsScreen();
+    }
+}
+
+void statsTouch(int x, int y) {
+    // Back button (top left area)
+    if (x < 80 && y < 50) {
+        screens.fire(EV_BACK);
+    }
+    // Page arrows in the side margins
+    else if (y >= 50 && x < 28) {
+        turnStatsPage(-1);
+    }
+    else if (y >= 50 && x > 292) {
+        turnStatsPage(1);
+    }
+}
+
+bool statsGesture(const Gesture& g) {
+    if (g.type != GESTURE_SWIPE) return false;
+    if (g.direction == SWIPE_LEFT) turnStatsPage(1);
+    else if (g.direction == SWIPE_RIGHT) turnStatsPage(-1);
+    return true;
+}
+
+// --- Quiz ---
+
+void quizEnter() {
+    generateQuestion();
+    speedClockResume();
+}
+
+void quizExit() {
+    stopQuestionPulse();
+}
+
+void quizUpdate(unsigned long now) {
+    // Answered - the feedback screen follows the question box's pulse
+    if (pulseFade) {
+        if (updateQuestionPulse(now)) {
+            screens.fire(EV_ANSWERED);
+            return;
+        }
+    } else if (roundMode != MODE_CLASSIC) {
+        if (speedTimeUp()) {
+            // The unanswered question doesn't count
+            speedClockPause();
+            stats.questionsThisRound--;
+            screens.fire(EV_ROUND_DONE);
+            return;
+        }
+        powerKeepAwake();  // Bar moves every frame
+        updateTimerBar();
+    }
+
+    if (updateEffects(now)) {
+        screens.redraw();  // Confetti finished - clean up
+    }
+    animateBuddy();
+}
+
+void quizTouch(int x, int y) {
+    if (pulseFade) return;  // Already answered
+
+    // Check which answer button was pressed
+    // Buttons are in 2x2 grid
+    int btnWidth = 145;
+    int btnHeight = 55;
+    int startX = 10;
+    int startY = 130;
+    int gapX = 10;
+    int gapY = 10;
+
+    Serial.printf("Checking buttons at touch (%d,%d)\n", x, y);
+
+    for (int i = 0; i < 4; i++) {
+        int col = i % 2;
+        int row = i / 2;
+        int btnX = startX + col * (btnWidth + gapX);
+        int btnY = startY + row * (btnHeight + gapY);
+
+        Serial.printf("  Btn %d: x=%d-%d, y=%d-%d\n", i, btnX, btnX+btnWidth, btnY, btnY+btnHeight);
+
+        if (x >= btnX && x <= btnX + btnWidth &&
+            y >= btnY && y <= btnY + btnHeight) {
+            Serial.printf("  -> MATCH! Selecting answer %d\n", i);
+            // Light the button up while the answer is checked
+            drawAnswerButton(i, color565AddSat(buttonColors[i], ANSWER_GLOW));
+            presentFrame();
+            checkAnswer(i);
+            break;
+        }
+    }
+}
+
+// --- Result (answer feedback over the quiz screen) ---
+
+void resultEnter() {
+    feedbackStartTime = millis();
+}
+
+void resultDraw() {
+    drawQuizScreen();
+    drawResultScreen(lastAnswerCorrect);
+}
+
+void resultUpdate(unsigned long now) {
+    powerKeepAwake();  // Feedback timeout is frame-driven
+    if (updateEffects(now)) {
+        screens.redraw();  // Confetti finished - clean up
+    } else if (confettiActive) {
+        // Redraw feedback text that confetti may have erased
+        drawResultScreen(lastAnswerCorrect);
+    }
+    animateBuddy();
+
+    unsigned long feedbackMs = (roundMode == MODE_CLASSIC) ? FEEDBACK_MS : SPEED_FEEDBACK_MS;
+    if (now - feedbackStartTime > feedbackMs) {
+        screens.fire(nextAfterFeedback());
+    }
+}
+
+// --- Achievement popup ---
+
+void achievementEnter() {
+    // Show the first newly unlocked achievement
+    for (int i = 0; i < NUM_ACHIEVEMENTS; i++) {
+        if (achievements[i].unlocked && !achievements[i].shown) {
+            achievements[i].shown = true;
+            currentAchievementIndex = i;
+            break;
+        }
+    }
+    confettiActive = false;
+    initStars();
+    playSfx(sfxAchievement);
+}
+
+void achievementDraw() {
+    drawAchievementPopup(currentAchievementIndex);
+}
+
+void achievementUpdate(unsigned long now) {
+    powerKeepAwake();
+    eraseStars();
+    for (int i = 0; i < physicsSteps; i++) {
+        stepStars();
+    }
+    drawStars();
+    // Redraw text that stars may have erased
+    if (frameAllows(PRIO_DECOR)) {
+        redrawAchievementText(currentAchievementIndex);
+    }
+}
+
+void achievementTouch(int x, int y) {
+    screens.fire(nextAfterFeedback());
+}
+
+// --- Round end ---
+
+void roundEndEnter() {
+    recordRound();
+    saveFactMastery();
+    if (roundMode != MODE_CLASSIC) {
+        finishSpeedRound();
+        if (speedClock.newBest) {
+            startConfetti();
+        }
+    } else if (stats.correctThisRound == CLASSIC_QUESTIONS) {
+        startConfetti();
+    }
+
+    // Start character dancing
+    buddy.dancing = true;
+    buddy.dead = false;
+    buddy.frame = 0;
+    buddy.lastFrameTime = millis();
+}
+
+void roundEndExit() {
+    buddy.dead = false;  // Revive character for new round
+    buddy.dancing = false;  // Stop dancing
+    buddy.y = 0;
+}
+
+void roundEndUpdate(unsigned long now) {
+    updateEffects(now);
+    animateBuddy();
+
+    // Redraw round-end text if confetti is active
+    if (confettiActive && frameAllows(PRIO_DECOR)) {
+        redrawRoundEndText();
+    }
+}
+
+void roundEndTouch(int x, int y) {
+    // Tap anywhere to start next round
+    startRound();
+    screens.fire(EV_PLAY);
+}
+
+// --- Shared helpers ---
+
+// Where to go once answer feedback (or an achievement popup) is done
+ScreenEvent nextAfterFeedback() {
+    for (int i = 0; i < NUM_ACHIEVEMENTS; i++) {
+        if (achievements[i].unlocked && !achievements[i].shown) {
+            return EV_ACHIEVEMENT;
+        }
+    }
+
+    // Check if round is complete (all questions, or the blitz clock ran out)
+    int length = roundLength();
+    if ((length > 0 && stats.questionsThisRound >= length) || speedTimeUp()) {
+        return EV_ROUND_DONE;
+    }
+    return EV_NEXT_QUESTION;
+}
+
+void startRound() {
+    stats.questionsThisRound = 0;
+    stats.correctThisRound = 0;
+    stats.answerMsThisRound = 0;
+    speedClock = SpeedClock();
+}
+
+// Questions per round, 0 = until the clock runs out
+int roundLength() {
+    switch (roundMode) {
+        case MODE_SPRINT: return SPRINT_QUESTIONS;
+        case MODE_BLITZ:  return 0;
+        default:          return CLASSIC_QUESTIONS;
+    }
+}
+
+// Step confetti one frame. Returns true on the frame it finishes.
+bool updateEffects(unsigned long now) {
+    if (!confettiActive) return false;
+    powerKeepAwake();
+
+    // Over budget - let extra particles retire instead of respawning
+    bool shedExtra = !frameAllows(PRIO_DECOR);
+
+    eraseConfetti();
+    for (int i = 0; i < physicsSteps; i++) {
+        stepConfetti(shedExtra);
+    }
+    drawConfetti();
+
+    // Stop confetti after 2 seconds
+    if (now - confettiStartTime > 2000) {
+        confettiActive = false;
+        return true;
+    }
+    return false;
+}
+
+void animateBuddy() {
+    if (buddy.jumping || buddy.dead || buddy.dancing) {
+        powerKeepAwake();
+    }
+    for (int i = 0; i < physicsSteps; i++) {
+        updateCharacter();
+    }
+    // Blit the cached pose - sends nothing if pose and position are unchanged
+    if (frameAllows(PRIO_DECOR)) {
+        blitCharacter();
+    }
+}
+
+// Math Facts screen flow. Anything not listed here is ignored by that screen.
+const ScreenTransition mathFactsTransitions[] = {
+    {SCREEN_SPLASH,      EV_CONTINUE,      SCREEN_MENU},
+    {SCREEN_MENU,        EV_BACK,          SCREEN_LAUNCHER},
+    {SCREEN_MENU,        EV_PLAY,          SCREEN_QUIZ},
+    {SCREEN_MENU,        EV_SHOW_STATS,    SCREEN_STATS},
+    {SCREEN_STATS,       EV_BACK,          SCREEN_MENU},
+    {SCREEN_QUIZ,        EV_ANSWERED,      SCREEN_RESULT},
+    {SCREEN_QUIZ,        EV_ROUND_DONE,    SCREEN_ROUND_END},
+    {SCREEN_RESULT,      EV_NEXT_QUESTION, SCREEN_QUIZ},
+    {SCREEN_RESULT,      EV_ACHIEVEMENT,   SCREEN_ACHIEVEMENT},
+    {SCREEN_RESULT,      EV_ROUND_DONE,    SCREEN_ROUND_END},
+    {SCREEN_ACHIEVEMENT, EV_NEXT_QUESTION, SCREEN_QUIZ},
+    {SCREEN_ACHIEVEMENT, EV_ACHIEVEMENT,   SCREEN_ACHIEVEMENT},
+    {SCREEN_ACHIEVEMENT, EV_ROUND_DONE,    SCREEN_ROUND_END},
+    {SCREEN_ROUND_END,   EV_PLAY,          SCREEN_QUIZ},
+};
+
+const MinigameScreen mathFactsScreens[] = {
+    //                     enter             exit           update             draw                touch               gesture
+    {SCREEN_SPLASH,      {nullptr,          nullptr,       nullptr,           drawSplashScreen,   splashTouch}},
+    {SCREEN_MENU,        {nullptr,          nullptr,       nullptr,           drawMenuScreen,     menuTouch}},
+    {SCREEN_STATS,       {statsEnter,       nullptr,       nullptr,           drawStatsScreen,    statsTouch,         statsGesture}},
+    {SCREEN_QUIZ,        {quizEnter,        quizExit,      quizUpdate,        drawQuizScreen,     quizTouch}},
+    {SCREEN_RESULT,      {resultEnter,      nullptr,       resultUpdate,      resultDraw,         nullptr}},
+    {SCREEN_ACHIEVEMENT, {achievementEnter, nullptr,       achievementUpdate, achievementDraw,    achievementTouch}},
+    {SCREEN_ROUND_END,   {roundEndEnter,    roundEndExit,  roundEndUpdate,    drawRoundEndScreen, roundEndTouch}},
+};
+
+void setupScreens() {
+    screens.addState(SCREEN_LAUNCHER, {launcherEnter, nullptr, nullptr, drawLauncherScreen, launcherTouch, launcherGesture});
+    screens.addState(SCREEN_PARENT, {nullptr, nullptr, nullptr, drawParentScreen, parentTouch, parentGesture});
+}
+
+// ============================================================================
+// MINIGAME REGISTRY
+// ============================================================================
+
+// Math Facts - assets and saved stats are only brought in by init()
+void mathFactsInit() {
+    confetti = new Confetti[MAX_CONFETTI];
+    stars = new Star[MAX_STARS];
+    initConfetti();
+    initStars();
+    initBuddySprites();
+
+    if (!profileLoaded || loadedGame != activeGame) {
+        loadStats();
+    }
+}
+
+int randomBelow(int n) {
+    return rngs[RNG_QUESTIONS].below(n);
+}
+
+template <class Op>
+void generateFactFor(Question& q) {
+    FactGenerator<Op>::generate(q, randomBelow);
+}
+
+// One init per operation - the generator is chosen here, once per game
+#if FACTS_MUL
+void mulFactsInit() {
+    generateFact = generateFactFor<MulOp>;
+    factsSubtitle = "Times Tables 1-12";
+    mathFactsInit();
+}
+#endif
+#if FACTS_ADD
+void addFactsInit() {
+    generateFact = generateFactFor<AddOp>;
+    factsSubtitle = "Adding 1-12";
+    mathFactsInit();
+}
+#endif
+#if FACTS_SUB
+void subFactsInit() {
+    generateFact = generateFactFor<SubOp>;
+    factsSubtitle = "Taking Away 1-12";
+    mathFactsInit();
+}
+#endif
+#if FACTS_DIV
+void divFactsInit() {
+    generateFact = generateFactFor<DivOp>;
+    factsSubtitle = "Dividing 1-12";
+    mathFactsInit();
+}
+#endif
+
+void mathFactsTeardown() {
+    saveFactMastery();
+    confettiActive = false;
+    delete[] confetti;
+    delete[] stars;
+    confetti = nullptr;
+    stars = nullptr;
+    freeBuddySprites();
+}
+
+// The four operations share screens and differ in generator and save bucket
+#define FACTS_GAME(title, left, right, color, prefix, init) {             \
+    title, "FACTS", left, right, color, prefix, init, mathFactsTeardown,   \
+    mathFactsScreens, sizeof(mathFactsScreens) / sizeof(mathFactsScreens[0]), \
+    mathFactsTransitions, sizeof(mathFactsTransitions) / sizeof(mathFactsTransitions[0]), \
+    SCREEN_SPLASH }
+
+#if FACTS_MUL
+const Minigame mulFactsGame = FACTS_GAME("MATH", "123", "x", COLOR_GREEN, LEGACY_STATS_PREFIX, mulFactsInit);
+#endif
+#if FACTS_ADD
+const Minigame addFactsGame = FACTS_GAME("PLUS", "1+2", "+", COLOR_ORANGE, "ma", addFactsInit);
+#endif
+#if FACTS_SUB
+const Minigame subFactsGame = FACTS_GAME("MINUS", "3-1", "-", COLOR_PURPLE, "ms", subFactsInit);
+#endif
+#if FACTS_DIV
+const Minigame divFactsGame = FACTS_GAME("SHARE", "6/2", "/", COLOR_PINK, "md", divFactsInit);
+#endif
+
+void registerFactsGames() {
+#if FACTS_MUL
+    registerGame(&mulFactsGame);
+#endif
+#if FACTS_ADD
+    registerGame(&addFactsGame);
+#endif
+#if FACTS_SUB
+    registerGame(&subFactsGame);
+#endif
+#if FACTS_DIV
+    registerGame(&divFactsGame);
+#endif
+}
+
+// Cheap by design: copies hook pointers only, so boot time stays flat
+void registerGame(const Minigame* game) {
+    if (numGames >= MAX_GAMES) return;
+
+    for (size_t i = 0; i < game->numScreens; i++) {
+        screens.addState(game->screens[i].id, game->screens[i].hooks);
+    }
+    screens.addTransitions(game->transitions, game->numTransitions);
+    games[numGames++] = game;
+}
+
+void enterGame(int index) {
+    activeGame = games[index];
+    Serial.printf("Entering %s %s\n", activeGame->title, activeGame->subtitle);
+    activeGame->init();
+    screens.go(activeGame->entryScreen);
+}
+
+void leaveGame() {
+    if (activeGame == nullptr) return;
+
+    activeGame->teardown();
+    activeGame = nullptr;
+}
+
+// ============================================================================
+// RANDOM NUMBERS
+// ============================================================================
+
+void seedRandom(uint32_t seed) {
+    rngSeed = seed;
+    for (int i = 0; i < NUM_RNG_STREAMS; i++) {
+        rngs[i].seed(seed, i);
+    }
+}
+
+void reportRng(const char* args) {
+    if (strncmp(args, "seed ", 5) == 0) {
+        seedRandom(strtoul(args + 5, nullptr, 0));
+    } else if (strcmp(args, "bench") == 0) {
+        // Same bounded draw both ways, as the particle loops use it
+        const int draws = 10000;
+        volatile int32_t sink = 0;
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < draws; i++) sink = sink + random(0, SCREEN_WIDTH);
+        uint32_t arduinoUs = esp_timer_get_time() - start;
+
+        Rng bench;
+        bench.seed(rngSeed, NUM_RNG_STREAMS);
+        start = esp_timer_get_time();
+        for (int i = 0; i < draws; i++) sink = sink + bench.range(0, SCREEN_WIDTH);
+        uint32_t rngUs = esp_timer_get_time() - start;
+
+        Serial.printf("  %d draws: random() %u us, Rng %u us\n", draws, arduinoUs, rngUs);
+    }
+    Serial.printf("  Seed %u (0x%08X) - streams:", rngSeed, rngSeed);
+    for (int i = 0; i < NUM_RNG_STREAMS; i++) {
+        Serial.printf(" %s", rngStreamNames[i]);
+    }
+    Serial.println();
+}
+
+// ============================================================================
+// QUESTION GENERATION
+// ============================================================================
+
+void generateQuestion() {
+    generateFact(currentQuestion);
+
+    questionStartUs = esp_timer_get_time();
+    stats.questionsThisRound++;
+
+    Serial.printf("Question: %d %c %d = %d (index %d)\n",
+                  currentQuestion.num1, currentQuestion.symbol, currentQuestion.num2,
+                  currentQuestion.correctAnswer, currentQuestion.correctIndex);
+}
+
+// ============================================================================
+// ANSWER CHECKING
+// ============================================================================
 
 void checkAnswer(int answerIndex) {
-    unsigned long answerTime = millis() - questionStartTime;
+    speedClockPause();
+    unsigned long answerTime = (esp_timer_get_time() - questionStartUs) / 1000;
     bool correct = (answerIndex == currentQuestion.correctIndex);
 
-    showingFeedback = true;
     lastAnswerCorrect = correct;  // Store for redrawing over confetti
-    feedbackMessageIndex = random(0, 5);  // Pick random message once
-    feedbackStartTime = millis();
+    factMastery.record(currentQuestion.fact, correct, answerTime);
+    stats.answerMsThisRound += answerTime;
+    feedbackMessageIndex = rngs[RNG_FEEDBACK].below(5);  // Pick random message once
 
     if (correct) {
         stats.totalCorrect++;
@@ -833,20 +2248,32 @@ void checkAnswer(int answerIndex) {
         }
 
         // Mark this table as practiced
-        int tableNum = min(currentQuestion.num1, currentQuestion.num2);
-        stats.tablesCompleted |= (1 << tableNum);
+        stats.tablesCompleted |= (1 << currentQuestion.table);
 
-        // Check for perfect round
-        if (stats.questionsThisRound >= 10 && stats.correctThisRound == stats.questionsThisRound) {
+        // Check for perfect round (a blitz has no fixed length to be perfect at)
+        if (stats.questionsThisRound == roundLength() && stats.correctThisRound == stats.questionsThisRound) {
             stats.perfectRounds++;
         }
 
+        // Blitz: win some time back
+        if (roundMode == MODE_BLITZ) {
+            speedClock.adjustUs += BLITZ_BONUS_MS * 1000LL;
+            if (stats.currentStreak % 5 == 0) {
+                speedClock.adjustUs += BLITZ_STREAK_BONUS_MS * 1000LL;
+            }
+        }
+
+        playSfx(sfxCorrect);
         animateCorrect();
         startConfetti();
         buddyJump();
     } else {
         stats.totalWrong++;
         stats.currentStreak = 0;
+        if (roundMode == MODE_SPRINT) {
+            speedClock.adjustUs += SPRINT_WRONG_PENALTY_MS * 1000LL;
+        }
+        playSfx(sfxWrong);
         animateWrong();
         buddyDie();
     }
@@ -854,8 +2281,117 @@ void checkAnswer(int answerIndex) {
     checkAchievements();
     saveStats();
 
-    // Draw result feedback on screen
-    drawResultScreen(correct);
+    // The result feedback follows once the pulse is over (quizUpdate)
+}
+
+// ============================================================================
+// SPEED ROUNDS
+// ============================================================================
+//
+// All round timing comes from esp_timer (microseconds, monotonic). The clock
+// is paused from the moment an answer is tapped until the next question is
+// on screen, so animations and achievement popups are free.
+
+void speedClockResume() {
+    if (roundMode == MODE_CLASSIC) return;
+    speedClock.resumedUs = esp_timer_get_time();
+}
+
+void speedClockPause() {
+    if (speedClock.resumedUs == 0) return;
+    speedClock.elapsedUs += esp_timer_get_time() - speedClock.resumedUs;
+    speedClock.resumedUs = 0;
+}
+
+int64_t speedElapsedUs() {
+    int64_t running = speedClock.resumedUs ? esp_timer_get_time() - speedClock.resumedUs : 0;
+    return speedClock.elapsedUs + running;
+}
+
+int64_t blitzRemainingUs() {
+    int64_t limitUs = BLITZ_MS * 1000LL + speedClock.adjustUs;
+    return max(limitUs - speedElapsedUs(), (int64_t)0);
+}
+
+// Sprint result: question time plus penalties
+uint32_t sprintScoreMs() {
+    return (speedElapsedUs() + speedClock.adjustUs) / 1000;
+}
+
+bool speedTimeUp() {
+    return roundMode == MODE_BLITZ && blitzRemainingUs() == 0;
+}
+
+// Called once on the round-end screen - records a personal best
+void finishSpeedRound() {
+    speedClock.newBest = false;
+
+    if (roundMode == MODE_SPRINT) {
+        uint32_t score = sprintScoreMs();
+        if (stats.sprintBestMs == 0 || score < stats.sprintBestMs) {
+            stats.sprintBestMs = score;
+            speedClock.newBest = true;
+        }
+    } else if (roundMode == MODE_BLITZ) {
+        if (stats.correctThisRound > stats.blitzBest) {
+            stats.blitzBest = stats.correctThisRound;
+            speedClock.newBest = true;
+        }
+    }
+
+    if (speedClock.newBest) {
+        saveStats();
+    }
+    Serial.printf("Speed round (%s): %d/%d correct, %.2f s on the clock%s\n",
+                  roundModeNames[roundMode], stats.correctThisRound, stats.questionsThisRound,
+                  speedElapsedUs() / 1e6, speedClock.newBest ? " - NEW BEST" : "");
+}
+
+// Timer bar fill and color for the current clock. Blitz counts down to zero;
+// a sprint counts down against the personal best (or a par time).
+void timerBarValue(int &value, int &maxVal, uint16_t &color) {
+    if (roundMode == MODE_BLITZ) {
+        value = blitzRemainingUs() / 1000;
+        maxVal = BLITZ_MS;
+    } else {
+        maxVal = stats.sprintBestMs ? stats.sprintBestMs : SPRINT_PAR_MS;
+        value = max((int)maxVal - (int)sprintScoreMs(), 0);
+    }
+    value = min(value, maxVal);
+
+    if (value * 5 < maxVal) {
+        color = COLOR_RED;
+    } else if (value * 2 < maxVal) {
+        color = COLOR_YELLOW;
+    } else {
+        color = roundModeColors[roundMode];
+    }
+}
+
+void drawTimerBar() {
+    TFT_PROFILE_SCOPE();
+    int value, maxVal;
+    uint16_t color;
+    timerBarValue(value, maxVal, color);
+    speedClock.barWidth = drawProgressBar(TIMER_BAR_X, TIMER_BAR_Y, TIMER_BAR_W, TIMER_BAR_H,
+                                          value, maxVal, color);
+    speedClock.barColor = color;
+}
+
+// Per frame: only the columns that changed are sent
+void updateTimerBar() {
+    TFT_PROFILE_SCOPE();
+    int value, maxVal;
+    uint16_t color;
+    timerBarValue(value, maxVal, color);
+
+    if (color != speedClock.barColor) {
+        // Crossed a threshold - recolor what is already filled
+        tft.fillRect(TIMER_BAR_X + 1, TIMER_BAR_Y + 1, speedClock.barWidth, TIMER_BAR_H - 2, color);
+        speedClock.barColor = color;
+    }
+    updateProgressBar(TIMER_BAR_X, TIMER_BAR_Y, TIMER_BAR_W, TIMER_BAR_H,
+                      value, maxVal, color, speedClock.barWidth);
 }
 
 // ============================================================================
@@ -932,52 +2468,254 @@ void checkAchievements() {
 // PERSISTENCE
 // ============================================================================
 
-void saveStats() {
+void profileNamespace(const char* prefix, int profile, char* out, size_t len) {
+    snprintf(out, len, "%s_p%d", prefix, profile);
+}
+
+void loadActiveProfile() {
+    prefs.begin("mathquiz", true);
+    activeProfile = prefs.getUChar("profile", 0);
+    prefs.end();
+    if (activeProfile >= NUM_PROFILES) activeProfile = 0;
+    profileLoaded = false;
+}
+
+void selectProfile(int profile) {
+    if (profile == activeProfile) return;
+
+    activeProfile = profile;
+    profileLoaded = false;  // Next loadStats() pulls this profile's blob
+
     prefs.begin("mathquiz", false);
-    prefs.putInt("correct", stats.totalCorrect);
-    prefs.putInt("wrong", stats.totalWrong);
-    prefs.putInt("streak", stats.currentStreak);
-    prefs.putInt("bestStreak", stats.bestStreak);
-    prefs.putInt("perfect", stats.perfectRounds);
-    prefs.putULong("fastest", stats.fastestAnswer);
-    prefs.putInt("tables", stats.tablesCompleted);
+    prefs.putUChar("profile", activeProfile);
+    prefs.end();
+
+    drawProfilePicker();
+}
+
+// Per-key stats kept in the shared "mathquiz" namespace by older firmware
+const char* const legacyStatKeys[] = {"correct", "wrong", "streak", "bestStreak", "perfect",
+                                      "fastest", "tables", "achieve", "shown"};
+
+// Wipes one player's saves in every game. Player 1's legacy keys go too, or
+// they would be migrated straight back in.
+void resetProfileProgress(int profile) {
+    char ns[16];
+    for (int i = 0; i < numGames; i++) {
+        profileNamespace(games[i]->prefsPrefix, profile, ns, sizeof(ns));
+        prefs.begin(ns, false);
+        prefs.clear();
+        prefs.end();
+    }
+    if (profile == 0) {
+        prefs.begin("mathquiz", false);
+        for (const char* key : legacyStatKeys) {
+            prefs.remove(key);
+        }
+        prefs.end();
+    }
+    if (profile == activeProfile) profileLoaded = false;
+    Serial.printf("Reset %s\n", profileNames[profile]);
+}
+
+void saveStats() {
+    ProfileBlob blob = {0};
+    blob.version = PROFILE_BLOB_VERSION;
+    blob.totalCorrect = stats.totalCorrect;
+    blob.totalWrong = stats.totalWrong;
+    blob.currentStreak = stats.currentStreak;
+    blob.bestStreak = stats.bestStreak;
+    blob.perfectRounds = stats.perfectRounds;
+    blob.fastestAnswer = stats.fastestAnswer;
+    blob.tablesCompleted = stats.tablesCompleted;
+    blob.sprintBestMs = stats.sprintBestMs;
+    blob.blitzBest = stats.blitzBest;
 
     // Save achievements (unlocked and shown status)
-    uint32_t achievementBits = 0;
-    uint32_t shownBits = 0;
     for (int i = 0; i < NUM_ACHIEVEMENTS; i++) {
         if (achievements[i].unlocked) {
-            achievementBits |= (1 << i);
+            blob.achieveBits |= (1 << i);
         }
         if (achievements[i].shown) {
-            shownBits |= (1 << i);
+            blob.shownBits |= (1 << i);
         }
     }
-    prefs.putUInt("achieve", achievementBits);
-    prefs.putUInt("shown", shownBits);
-    prefs.end();
+
+    char ns[16];
+    profileNamespace(activeGame->prefsPrefix, activeProfile, ns, sizeof(ns));
+    putBlob(ns, "stats", &blob, sizeof(blob));
 }
 
 void loadStats() {
-    prefs.begin("mathquiz", true);
-    stats.totalCorrect = prefs.getInt("correct", 0);
-    stats.totalWrong = prefs.getInt("wrong", 0);
-    stats.currentStreak = prefs.getInt("streak", 0);
-    stats.bestStreak = prefs.getInt("bestStreak", 0);
-    stats.perfectRounds = prefs.getInt("perfect", 0);
-    stats.fastestAnswer = prefs.getULong("fastest", 0);
-    stats.tablesCompleted = prefs.getInt("tables", 0);
-
-    // Load achievements (unlocked and shown status)
-    uint32_t achievementBits = prefs.getUInt("achieve", 0);
-    uint32_t shownBits = prefs.getUInt("shown", 0);
+    ProfileBlob blob = {0};
+
+    // One open of this profile's namespace for all three blobs - other
+    // profiles are never touched
+    char ns[16];
+    profileNamespace(activeGame->prefsPrefix, activeProfile, ns, sizeof(ns));
+    prefs.begin(ns, true);
+    size_t len = prefs.getBytes("stats", &blob, sizeof(blob));
+
+    // Per-fact records sit beside the blob; none yet reads as all unseen
+    size_t factLen = prefs.getBytesLength("facts");
+    if (factLen == FactMastery::dataSize() &&
+        prefs.getBytes("facts", factMastery.data(), factLen) == factLen) {
+        factMastery.loaded();
+    } else if (factLen == FactMastery::dataSizeV1()) {
+        // Saved by earlier firmware at 4 bytes a fact
+        FactRecordV1 old[FACT_COUNT];
+        prefs.getBytes("facts", old, sizeof(old));
+        factMastery.loadedV1(old);
+    } else {
+        factMastery.clear();
+    }
+
+    size_t roundsLen = prefs.getBytes("rounds", roundHistory.data(), RoundHistory::dataSize());
+    prefs.end();
+    if (roundsLen != RoundHistory::dataSize()) {
+        roundHistory.clear();
+    }
+    roundHistory.loaded();
+    roundTrend.rebuild(roundHistory);
+
+    // A version 1 blob is the same record without the tail - it reads as
+    // no personal bests yet
+    bool current = (len == sizeof(blob) && blob.version == PROFILE_BLOB_VERSION);
+    bool v1 = (len == PROFILE_BLOB_V1_SIZE && blob.version == 1);
+    if (!current && !v1) {
+        memset(&blob, 0, sizeof(blob));
+        // Profile 1 inherits progress saved before profiles existed
+        if (activeProfile == 0 && strcmp(activeGame->prefsPrefix, LEGACY_STATS_PREFIX) == 0) {
+            migrateLegacyStats(blob);
+        }
+    }
+
+    stats.totalCorrect = blob.totalCorrect;
+    stats.totalWrong = blob.totalWrong;
+    stats.currentStreak = blob.currentStreak;
+    stats.bestStreak = blob.bestStreak;
+    stats.perfectRounds = blob.perfectRounds;
+    stats.fastestAnswer = blob.fastestAnswer;
+    stats.tablesCompleted = blob.tablesCompleted;
+    stats.sprintBestMs = blob.sprintBestMs;
+    stats.blitzBest = blob.blitzBest;
+    stats.questionsThisRound = 0;
+    stats.correctThisRound = 0;
+    stats.answerMsThisRound = 0;
+
     for (int i = 0; i < NUM_ACHIEVEMENTS; i++) {
-        achievements[i].unlocked = (achievementBits & (1 << i)) != 0;
-        achievements[i].shown = (shownBits & (1 << i)) != 0;
+        achievements[i].unlocked = (blob.achieveBits & (1 << i)) != 0;
+        achievements[i].shown = (blob.shownBits & (1 << i)) != 0;
+    }
+    profileLoaded = true;
+    loadedGame = activeGame;
+
+    Serial.printf("Loaded %s: %d correct, %d streak\n",
+                  profileNames[activeProfile], stats.totalCorrect, stats.currentStreak);
+}
+
+// The per-fact records are 288 bytes, so unlike the stats blob they are not
+// rewritten after every answer - only when a round ends or the game is left.
+// A failed save stays dirty and is tried again next time.
+void saveFactMastery() {
+    if (!factMastery.dirty()) return;
+
+    char ns[16];
+    profileNamespace(activeGame->prefsPrefix, activeProfile, ns, sizeof(ns));
+    if (putBlob(ns, "facts", factMastery.data(), FactMastery::dataSize())) {
+        factMastery.saved();
+    }
+}
+
+// Adds the round just finished to the history and saves it - one 100-byte
+// blob, once per round
+void recordRound() {
+    if (stats.questionsThisRound == 0) return;
+
+    RoundRecord round = {0};
+    round.mode = roundMode;
+    round.questions = min(stats.questionsThisRound, 255);
+    round.correct = min(stats.correctThisRound, 255);
+    round.avgMs = min(stats.answerMsThisRound / stats.questionsThisRound, 65535UL);
+    roundHistory.append(round);
+    roundTrend.appended(roundHistory);
+    Serial.printf("Round: %s %d/%d, %u ms per answer\n", roundModeNames[roundMode],
+                  round.correct, round.questions, round.avgMs);
+
+    char ns[16];
+    profileNamespace(activeGame->prefsPrefix, activeProfile, ns, sizeof(ns));
+    putBlob(ns, "rounds", roundHistory.data(), RoundHistory::dataSize());
+}
+
+// Every save goes through here, so 'nvs' can show what saving costs.
+// Returns false when the blob was not written - usually a full partition.
+bool putBlob(const char* ns, const char* key, const void* data, size_t len) {
+    int64_t start = esp_timer_get_time();
+    prefs.begin(ns, false);
+    size_t written = prefs.putBytes(key, data, len);
+    size_t left = prefs.freeEntries();
+    prefs.end();
+
+    uint32_t us = esp_timer_get_time() - start;
+    nvsWrites++;
+    nvsWriteBytes += len;
+    nvsWriteUs += us;
+    if (us > nvsWorstUs) nvsWorstUs = us;
+
+    if (written != len) {
+        nvsFailures++;
+        Serial.printf("Save failed: %s/%s, %u bytes, %u entries free\n",
+                      ns, key, (unsigned)len, (unsigned)left);
+        return false;
+    }
+    return true;
+}
+
+void reportNvs(const char* args) {
+    Serial.printf("Saves: %u, %u bytes, %u failed\n", nvsWrites, nvsWriteBytes, nvsFailures);
+    if (nvsWrites > 0) {
+        Serial.printf("  time: %u us avg, %u us worst\n", nvsWriteUs / nvsWrites, nvsWorstUs);
+    }
+    nvs_stats_t nvs;
+    if (nvs_get_stats(NULL, &nvs) == ESP_OK) {
+        Serial.printf("  entries: %u used, %u free of %u, %u namespaces\n",
+                      (unsigned)nvs.used_entries, (unsigned)nvs.free_entries,
+                      (unsigned)nvs.total_entries, (unsigned)nvs.namespace_count);
+    }
+}
+
+// One-time import of the per-key stats stored in the shared "mathquiz"
+// namespace by older firmware. Fills in and saves profile 1's blob, then drops
+// the old keys. Returns false (blob untouched) when there is nothing to migrate.
+bool migrateLegacyStats(ProfileBlob &blob) {
+    prefs.begin("mathquiz", false);
+    if (!prefs.isKey("correct")) {
+        prefs.end();
+        return false;
+    }
+
+    blob.version = PROFILE_BLOB_VERSION;
+    blob.totalCorrect = prefs.getInt("correct", 0);
+    blob.totalWrong = prefs.getInt("wrong", 0);
+    blob.currentStreak = prefs.getInt("streak", 0);
+    blob.bestStreak = prefs.getInt("bestStreak", 0);
+    blob.perfectRounds = prefs.getInt("perfect", 0);
+    blob.fastestAnswer = prefs.getULong("fastest", 0);
+    blob.tablesCompleted = prefs.getInt("tables", 0);
+    blob.achieveBits = prefs.getUInt("achieve", 0);
+    blob.shownBits = prefs.getUInt("shown", 0);
+
+    for (const char* key : legacyStatKeys) {
+        prefs.remove(key);
     }
     prefs.end();
 
-    Serial.printf("Loaded stats: %d correct, %d streak\n", stats.totalCorrect, stats.currentStreak);
+    char ns[16];
+    profileNamespace(LEGACY_STATS_PREFIX, 0, ns, sizeof(ns));
+    putBlob(ns, "stats", &blob, sizeof(blob));
+
+    Serial.println("Migrated legacy stats to PLAYER 1");
+    return true;
 }
 
 // ============================================================================
@@ -991,27 +2729,36 @@ void initConfetti() {
 }
 
 void startConfetti() {
+    Rng& rng = rngs[RNG_CONFETTI];
     confettiActive = true;
     confettiStartTime = millis();
 
     for (int i = 0; i < MAX_CONFETTI; i++) {
-        confetti[i].x = random(0, SCREEN_WIDTH);
-        confetti[i].y = random(-50, 0);
-        confetti[i].vx = random(-30, 30) / 10.0f;
-        confetti[i].vy = random(20, 60) / 10.0f;
-        confetti[i].color = rainbowColors[random(0, NUM_RAINBOW_COLORS)];
-        confetti[i].size = random(3, 8);
+        confetti[i].x = rng.range(0, SCREEN_WIDTH);
+        confetti[i].y = rng.range(-50, 0);
+        confetti[i].vx = rng.range(-30, 30) / 10.0f;
+        confetti[i].vy = rng.range(20, 60) / 10.0f;
+        confetti[i].color = rainbowColors[rng.below(NUM_RAINBOW_COLORS)];
+        confetti[i].size = rng.range(3, 8);
         confetti[i].active = true;
     }
 }
 
-void updateConfetti() {
+void eraseConfetti() {
+    TFT_PROFILE_SCOPE();
     for (int i = 0; i < MAX_CONFETTI; i++) {
         if (confetti[i].active) {
-            // Erase old position
             tft.fillRect(confetti[i].x, confetti[i].y,
                         confetti[i].size, confetti[i].size, COLOR_BG);
+        }
+    }
+}
 
+// One fixed physics step
+void stepConfetti(bool shedExtra) {
+    Rng& rng = rngs[RNG_CONFETTI];
+    for (int i = 0; i < MAX_CONFETTI; i++) {
+        if (confetti[i].active) {
             // Update position
             confetti[i].x += confetti[i].vx;
             confetti[i].y += confetti[i].vy;
@@ -1020,16 +2767,21 @@ void updateConfetti() {
 
             // Check bounds
             if (confetti[i].y > SCREEN_HEIGHT + 10) {
+                if (shedExtra && i >= MIN_CONFETTI) {
+                    confetti[i].active = false;
+                    continue;
+                }
                 // Respawn at top
-                confetti[i].x = random(0, SCREEN_WIDTH);
-                confetti[i].y = random(-20, 0);
-                confetti[i].vy = random(20, 40) / 10.0f;
+                confetti[i].x = rng.range(0, SCREEN_WIDTH);
+                confetti[i].y = rng.range(-20, 0);
+                confetti[i].vy = rng.range(20, 40) / 10.0f;
             }
         }
     }
 }
 
 void drawConfetti() {
+    TFT_PROFILE_SCOPE();
     for (int i = 0; i < MAX_CONFETTI; i++) {
         if (confetti[i].active) {
             tft.fillRect(confetti[i].x, confetti[i].y,
@@ -1043,23 +2795,32 @@ void drawConfetti() {
 // ============================================================================
 
 void initStars() {
+    Rng& rng = rngs[RNG_STARS];
     for (int i = 0; i < MAX_STARS; i++) {
         stars[i].x = SCREEN_WIDTH / 2;
         stars[i].y = SCREEN_HEIGHT / 2;
-        stars[i].angle = random(0, 360) * PI / 180.0f;
-        stars[i].speed = random(20, 50) / 10.0f;
-        stars[i].size = random(2, 6);
-        stars[i].color = rainbowColors[random(0, NUM_RAINBOW_COLORS)];
+        stars[i].angle = rng.range(0, 360) * PI / 180.0f;
+        stars[i].speed = rng.range(20, 50) / 10.0f;
+        stars[i].size = rng.range(2, 6);
+        stars[i].color = rainbowColors[rng.below(NUM_RAINBOW_COLORS)];
         stars[i].active = true;
     }
 }
 
-void updateStars() {
+void eraseStars() {
+    TFT_PROFILE_SCOPE();
     for (int i = 0; i < MAX_STARS; i++) {
         if (stars[i].active) {
-            // Erase old position
             tft.fillCircle(stars[i].x, stars[i].y, stars[i].size, COLOR_BG);
+        }
+    }
+}
 
+// One fixed physics step
+void stepStars() {
+    Rng& rng = rngs[RNG_STARS];
+    for (int i = 0; i < MAX_STARS; i++) {
+        if (stars[i].active) {
             // Update position (burst outward)
             stars[i].x += cos(stars[i].angle) * stars[i].speed;
             stars[i].y += sin(stars[i].angle) * stars[i].speed;
@@ -1071,15 +2832,16 @@ void updateStars() {
                 stars[i].speed < 0.5f) {
                 stars[i].x = SCREEN_WIDTH / 2;
                 stars[i].y = SCREEN_HEIGHT / 2;
-                stars[i].angle = random(0, 360) * PI / 180.0f;
-                stars[i].speed = random(20, 50) / 10.0f;
-                stars[i].color = rainbowColors[random(0, NUM_RAINBOW_COLORS)];
+                stars[i].angle = rng.range(0, 360) * PI / 180.0f;
+                stars[i].speed = rng.range(20, 50) / 10.0f;
+                stars[i].color = rainbowColors[rng.below(NUM_RAINBOW_COLORS)];
             }
         }
     }
 }
 
 void drawStars() {
+    TFT_PROFILE_SCOPE();
     for (int i = 0; i < MAX_STARS; i++) {
         if (stars[i].active) {
             tft.fillCircle(stars[i].x, stars[i].y, stars[i].size, stars[i].color);
@@ -1091,60 +2853,143 @@ void drawStars() {
 // CHARACTER (Little buddy in corner)
 // ============================================================================
 
+// Full draw after the screen under the buddy was repainted
 void drawCharacter() {
-    int x = buddy.x;
-    int y = buddy.baseY - (int)buddy.y;  // y offset for jumping
+    TFT_PROFILE_SCOPE();
+    buddyDrawnPose = -1;
+    blitCharacter();
+}
 
-    // Dance offset for wiggling
-    int danceOffset = 0;
-    if (buddy.dancing) {
-        danceOffset = (buddy.frame % 2 == 0) ? -1 : 1;
+BuddyPose currentBuddyPose() {
+    if (buddy.dead) return POSE_DEAD;
+    if (buddy.dancing) return (buddy.frame % 2 == 0) ? POSE_DANCE_A : POSE_DANCE_B;
+    if (buddy.jumping) return POSE_HAPPY;
+    return POSE_IDLE;
+}
+
+// Sends the buddy in one windowed write covering both the old and the new
+// position, so the old pose is erased in the same pass. Transparent pixels
+// become COLOR_BG. Nothing is sent if pose and position are unchanged.
+void blitCharacter() {
+    TFT_PROFILE_SCOPE();
+    BuddyPose pose = currentBuddyPose();
+    int x = buddy.x - BUDDY_ORIGIN_X;
+    int newTop = buddy.baseY - (int)buddy.y - BUDDY_ORIGIN_Y;
+
+    if (pose == buddyDrawnPose && newTop == buddyDrawnTop) return;
+
+    int top = newTop;
+    int bottom = newTop + BUDDY_H;
+    if (buddyDrawnPose >= 0) {
+        top = min(top, buddyDrawnTop);
+        bottom = max(bottom, buddyDrawnTop + BUDDY_H);
+        if (bottom - top > BUDDY_SCRATCH_H) {
+            // Moved too far for one window - clear the old spot separately
+            tft.fillRect(x, buddyDrawnTop, BUDDY_W, BUDDY_H, COLOR_BG);
+            top = newTop;
+            bottom = newTop + BUDDY_H;
+        }
+    }
+    buddyDrawnPose = pose;
+    buddyDrawnTop = newTop;
+
+    // Jumps go off the top of the screen
+    top = max(top, 0);
+    bottom = min(bottom, SCREEN_HEIGHT);
+    if (bottom <= top) return;
+
+    const uint16_t bg = (uint16_t)((COLOR_BG >> 8) | (COLOR_BG << 8));
+    const uint16_t key = (uint16_t)((BUDDY_KEY >> 8) | (BUDDY_KEY << 8));
+    const uint16_t* sprite = buddySprites + pose * BUDDY_W * BUDDY_H;
+
+    for (int row = top; row < bottom; row++) {
+        uint16_t* out = buddyScratch + (row - top) * BUDDY_W;
+        int spriteRow = row - newTop;
+        if (spriteRow < 0 || spriteRow >= BUDDY_H) {
+            for (int col = 0; col < BUDDY_W; col++) out[col] = bg;
+            continue;
+        }
+        const uint16_t* in = sprite + spriteRow * BUDDY_W;
+        for (int col = 0; col < BUDDY_W; col++) {
+            out[col] = (in[col] == key) ? bg : in[col];
+        }
     }
 
-    if (buddy.dead) {
+    pushWindow(x, top, BUDDY_W, bottom - top, buddyScratch);
+}
+
+// Render every pose once with the usual primitives into RAM
+void initBuddySprites() {
+    buddySprites = new uint16_t[NUM_POSES * BUDDY_W * BUDDY_H];
+    buddyScratch = new uint16_t[BUDDY_W * BUDDY_SCRATCH_H];
+    buddyDrawnPose = -1;
+
+    TFT_eSprite poseSprite = TFT_eSprite(&display);
+    poseSprite.setColorDepth(16);
+    poseSprite.createSprite(BUDDY_W, BUDDY_H);
+    for (int pose = 0; pose < NUM_POSES; pose++) {
+        poseSprite.fillSprite(BUDDY_KEY);
+        drawBuddyPose(poseSprite, (BuddyPose)pose, BUDDY_ORIGIN_X, BUDDY_ORIGIN_Y);
+        memcpy(buddySprites + pose * BUDDY_W * BUDDY_H, poseSprite.getPointer(),
+               BUDDY_W * BUDDY_H * sizeof(uint16_t));
+    }
+    poseSprite.deleteSprite();
+}
+
+void freeBuddySprites() {
+    delete[] buddySprites;
+    delete[] buddyScratch;
+    buddySprites = nullptr;
+    buddyScratch = nullptr;
+}
+
+void drawBuddyPose(TFT_eSPI &gfx, BuddyPose pose, int x, int y) {
+    if (pose == POSE_DEAD) {
         // Dead character - X eyes, lying down (smaller)
         // Body (horizontal, fallen over)
-        tft.fillRoundRect(x - 8, y + 3, 16, 6, 2, COLOR_YELLOW);
+        gfx.fillRoundRect(x - 8, y + 3, 16, 6, 2, COLOR_YELLOW);
         // Head
-        tft.fillCircle(x - 10, y + 2, 5, COLOR_YELLOW);
+        gfx.fillCircle(x - 10, y + 2, 5, COLOR_YELLOW);
         // X eyes
-        tft.drawLine(x - 12, y, x - 9, y + 3, COLOR_BLACK);
-        tft.drawLine(x - 9, y, x - 12, y + 3, COLOR_BLACK);
-        tft.drawLine(x - 8, y, x - 5, y + 3, COLOR_BLACK);
-        tft.drawLine(x - 5, y, x - 8, y + 3, COLOR_BLACK);
+        gfx.drawLine(x - 12, y, x - 9, y + 3, COLOR_BLACK);
+        gfx.drawLine(x - 9, y, x - 12, y + 3, COLOR_BLACK);
+        gfx.drawLine(x - 8, y, x - 5, y + 3, COLOR_BLACK);
+        gfx.drawLine(x - 5, y, x - 8, y + 3, COLOR_BLACK);
         // Tongue out
-        tft.fillRect(x - 11, y + 5, 2, 2, COLOR_RED);
+        gfx.fillRect(x - 11, y + 5, 2, 2, COLOR_RED);
+        return;
+    }
+
+    // Smaller character - about half size. Dance frames wiggle left/right.
+    bool dancing = (pose == POSE_DANCE_A || pose == POSE_DANCE_B);
+    int xOff = dancing ? (pose == POSE_DANCE_A ? -1 : 1) : 0;
+    // Body
+    gfx.fillRoundRect(x - 3 + xOff, y - 2, 6, 10, 2, COLOR_YELLOW);
+    // Head
+    gfx.fillCircle(x + xOff, y - 7, 5, COLOR_YELLOW);
+    // Eyes (depending on state)
+    if (pose != POSE_IDLE) {
+        // Happy eyes (arcs) - smaller
+        gfx.drawPixel(x - 2 + xOff, y - 8, COLOR_BLACK);
+        gfx.drawPixel(x - 1 + xOff, y - 9, COLOR_BLACK);
+        gfx.drawPixel(x + 1 + xOff, y - 9, COLOR_BLACK);
+        gfx.drawPixel(x + 2 + xOff, y - 8, COLOR_BLACK);
     } else {
-        // Smaller character - about half size
-        int xOff = danceOffset;
-        // Body
-        tft.fillRoundRect(x - 3 + xOff, y - 2, 6, 10, 2, COLOR_YELLOW);
-        // Head
-        tft.fillCircle(x + xOff, y - 7, 5, COLOR_YELLOW);
-        // Eyes (depending on state)
-        if (buddy.jumping || buddy.dancing) {
-            // Happy eyes (arcs) - smaller
-            tft.drawPixel(x - 2 + xOff, y - 8, COLOR_BLACK);
-            tft.drawPixel(x - 1 + xOff, y - 9, COLOR_BLACK);
-            tft.drawPixel(x + 1 + xOff, y - 9, COLOR_BLACK);
-            tft.drawPixel(x + 2 + xOff, y - 8, COLOR_BLACK);
-        } else {
-            // Normal eyes (dots)
-            tft.fillCircle(x - 2 + xOff, y - 8, 1, COLOR_BLACK);
-            tft.fillCircle(x + 2 + xOff, y - 8, 1, COLOR_BLACK);
-        }
-        // Mouth (smile)
-        tft.drawPixel(x - 1 + xOff, y - 4, COLOR_BLACK);
-        tft.drawPixel(x + xOff, y - 3, COLOR_BLACK);
-        tft.drawPixel(x + 1 + xOff, y - 4, COLOR_BLACK);
-        // Legs (alternate when dancing)
-        int legOffset = buddy.dancing ? (buddy.frame % 2 == 0 ? 1 : -1) : 0;
-        tft.fillRect(x - 3 + xOff, y + 8 + legOffset, 2, 4, COLOR_YELLOW);
-        tft.fillRect(x + 1 + xOff, y + 8 - legOffset, 2, 4, COLOR_YELLOW);
-        // Feet
-        tft.fillRect(x - 4 + xOff, y + 11 + legOffset, 3, 2, COLOR_ORANGE);
-        tft.fillRect(x + 1 + xOff, y + 11 - legOffset, 3, 2, COLOR_ORANGE);
+        // Normal eyes (dots)
+        gfx.fillCircle(x - 2 + xOff, y - 8, 1, COLOR_BLACK);
+        gfx.fillCircle(x + 2 + xOff, y - 8, 1, COLOR_BLACK);
     }
+    // Mouth (smile)
+    gfx.drawPixel(x - 1 + xOff, y - 4, COLOR_BLACK);
+    gfx.drawPixel(x + xOff, y - 3, COLOR_BLACK);
+    gfx.drawPixel(x + 1 + xOff, y - 4, COLOR_BLACK);
+    // Legs (alternate when dancing)
+    int legOffset = dancing ? (pose == POSE_DANCE_A ? 1 : -1) : 0;
+    gfx.fillRect(x - 3 + xOff, y + 8 + legOffset, 2, 4, COLOR_YELLOW);
+    gfx.fillRect(x + 1 + xOff, y + 8 - legOffset, 2, 4, COLOR_YELLOW);
+    // Feet
+    gfx.fillRect(x - 4 + xOff, y + 11 + legOffset, 3, 2, COLOR_ORANGE);
+    gfx.fillRect(x + 1 + xOff, y + 11 - legOffset, 3, 2, COLOR_ORANGE);
 }
 
 void updateCharacter() {
@@ -1179,6 +3024,7 @@ void buddyJump() {
     if (!buddy.dead && !buddy.jumping) {
         buddy.jumping = true;
         buddy.vy = 8.0f;  // Jump velocity (smaller for small character)
+        playSfx(sfxJump);
     }
 }
 
@@ -1189,44 +3035,385 @@ void buddyDie() {
     buddy.y = 0;
 }
 
+// ============================================================================
+// SCREEN LAYERS
+// ============================================================================
+//
+// Static backgrounds are streamed from flash in one pass: decoded a band at a
+// time into assetBands, one band decoding while DMA sends the other. Screens
+// then draw their text on top. drawLayerPrimitives() is the old way of
+// building the same layers, kept so "layers bench" can time both.
+
+void drawLayer(ScreenLayer layer) {
+    TFT_PROFILE_SCOPE();
+    int64_t start = esp_timer_get_time();
+    streamImage(*layers[layer].image, 0, 0);
+    layers[layer].streamUs = esp_timer_get_time() - start;
+}
+
+void streamImage(const RleImage& image, int x, int y) {
+    RleDecoder decoder(image);
+
+#if INDEXED_FRAMEBUFFER
+    for (int row = 0; row < image.height; row += ASSET_BAND_LINES) {
+        int lines = min(ASSET_BAND_LINES, image.height - row);
+        decoder.read(assetBands[0], image.width * lines);
+        canvas.pushImage565(x, y + row, image.width, lines, assetBands[0]);
+    }
+#else
+#if DISPLAY_LIST
+    displayList.occlude(x, y, image.width, image.height);
+#endif
+#if TFT_PROFILER
+    int64_t pushStart = esp_timer_get_time();
+#endif
+    display.startWrite();
+    display.setAddrWindow(x, y, image.width, image.height);
+    int buffer = 0;
+    size_t n;
+    while ((n = decoder.read(assetBands[buffer], ASSET_BAND_PIXELS)) > 0) {
+        if (displayDma) {
+            // Waits for the previous band before starting this one
+            display.pushPixelsDMA(assetBands[buffer], n);
+            buffer ^= 1;
+        } else {
+            display.pushPixels(assetBands[buffer], n);
+        }
+    }
+    if (displayDma) display.dmaWait();
+    display.endWrite();
+#if TFT_PROFILER
+    profiledTft.recordPush(image.width * image.height, pushStart);
+#endif
+#endif
+}
+
+void drawLayerPrimitives(ScreenLayer layer) {
+    TFT_PROFILE_SCOPE();
+    tft.fillScreen(COLOR_BG);
+    switch (layer) {
+        case LAYER_SPLASH:
+            // Same stars every time, like the pre-rendered layer
+            rngs[RNG_DECOR].seed(15, RNG_DECOR);
+            for (int i = 0; i < 15; i++) {
+                Rng& rng = rngs[RNG_DECOR];
+                int sx = rng.range(0, SCREEN_WIDTH);
+                int sy = rng.range(0, SCREEN_HEIGHT);
+                tft.fillCircle(sx, sy, rng.range(1, 3), rainbowColors[rng.below(NUM_RAINBOW_COLORS)]);
+            }
+            break;
+        case LAYER_MENU:
+            fillRoundedRect(60, 80, 200, 70, 15, COLOR_GREEN);
+            fillRoundedRect(60, 170, 200, 50, 10, COLOR_CYAN);
+            break;
+        case LAYER_ACHIEVEMENT:
+            fillRoundedRect(120, 90, 80, 80, 20, COLOR_GOLD);
+            break;
+        case LAYER_ROUND_END:
+            fillRoundedRect(80, 85, 160, 80, 20, COLOR_BG_LIGHT);
+            fillRoundedRect(60, 205, 200, 30, 10, COLOR_GREEN);
+            break;
+        default:
+            break;
+    }
+}
+
+// "layers bench" draws every layer both ways (the screen is repainted after)
+void reportLayers(const char* args) {
+    if (strcmp(args, "bench") == 0) {
+        for (int i = 0; i < NUM_LAYERS; i++) {
+            int64_t start = esp_timer_get_time();
+            drawLayerPrimitives((ScreenLayer)i);
+            presentFrame();
+            layers[i].primitiveUs = esp_timer_get_time() - start;
+
+            drawLayer((ScreenLayer)i);
+            start = esp_timer_get_time();
+            presentFrame();
+            layers[i].streamUs += esp_timer_get_time() - start;
+        }
+        screens.redraw();
+        presentFrame();
+    }
+
+    Serial.printf("  %-12s %9s %10s %13s\n", "layer", "bytes", "stream us", "primitive us");
+    for (int i = 0; i < NUM_LAYERS; i++) {
+        Serial.printf("  %-12s %9u %10u %13u\n", layers[i].name, layers[i].image->size,
+                      layers[i].streamUs, layers[i].primitiveUs);
+    }
+    Serial.printf("  (uncompressed: %u bytes each)\n", SCREEN_WIDTH * SCREEN_HEIGHT * 2);
+}
+
+// ============================================================================
+// SCREENSHOTS
+// ============================================================================
+//
+// 'shot' reads the panel's GRAM back a band at a time into assetBands and
+// RLE-encodes it on the way out, so a capture needs no screen-sized buffer.
+// The stream (RleImage.h's format) goes out as base64 lines between markers
+// that tools/screenshot.py looks for:
+//
+//   # shot begin 320x240 frame=1234 t_us=56789012 frame_us=21034 reason=slow
+//   gAAh...
+//   # shot end bytes=9120 read_us=41230 total_us=812345
+//
+// frame and frame_us are the last frame run before the capture; t_us is when
+// the capture started. 'shot N' and 'shot slow' capture from the main loop
+// straight after a frame is sent, so mid-animation frames come out as drawn.
+// The time spent capturing is taken out of the frame clock.
+
+void shotSendLine() {
+    static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    char text[SHOT_LINE_BYTES / 3 * 4 + 5];
+    int n = 0;
+    for (int i = 0; i < shotLineLen; i += 3) {
+        uint32_t v = shotLine[i] << 16;
+        if (i + 1 < shotLineLen) v |= shotLine[i + 1] << 8;
+        if (i + 2 < shotLineLen) v |= shotLine[i + 2];
+        text[n++] = digits[(v >> 18) & 0x3F];
+        text[n++] = digits[(v >> 12) & 0x3F];
+        text[n++] = i + 1 < shotLineLen ? digits[(v >> 6) & 0x3F] : '=';
+        text[n++] = i + 2 < shotLineLen ? digits[v & 0x3F] : '=';
+    }
+    text[n] = '\0';
+    Serial.println(text);
+    shotLineLen = 0;
+}
+
+void shotEmit(const uint8_t* bytes, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        shotLine[shotLineLen++] = bytes[i];
+        if (shotLineLen == SHOT_LINE_BYTES) shotSendLine();
+    }
+}
+
+// Returns how long the capture took, for the frame clock
+int64_t captureScreen(const char* reason) {
+    int64_t start = esp_timer_get_time();
+    const FrameStats& fs = frameScheduler.getStats();
+    Serial.printf("# shot begin %dx%d frame=%u t_us=%lld frame_us=%u reason=%s\n",
+                  SCREEN_WIDTH, SCREEN_HEIGHT, fs.frames, (long long)start, fs.lastFrameUs, reason);
+
+    RleEncoder encoder(shotEmit);
+    shotLineLen = 0;
+    int64_t readUs = 0;
+    for (int row = 0; row < SCREEN_HEIGHT; row += ASSET_BAND_LINES) {
+        int lines = min(ASSET_BAND_LINES, SCREEN_HEIGHT - row);
+        int64_t readStart = esp_timer_get_time();
+        display.readRect(0, row, SCREEN_WIDTH, lines, assetBands[0]);
+        readUs += esp_timer_get_time() - readStart;
+        encoder.write(assetBands[0], SCREEN_WIDTH * lines);
+    }
+    encoder.finish();
+    if (shotLineLen > 0) shotSendLine();
+
+    int64_t totalUs = esp_timer_get_time() - start;
+    Serial.printf("# shot end bytes=%u read_us=%lld total_us=%lld\n",
+                  encoder.size(), (long long)readUs, (long long)totalUs);
+    return totalUs;
+}
+
+// From loop(), after a frame has been sent to the panel
+void shotAfterFrame() {
+    if (shotFramesLeft == 0 && !shotOnSlowFrame) return;
+
+    const char* reason = nullptr;
+    if (shotFramesLeft > 0) {
+        shotFramesLeft--;
+        reason = "frame";
+    } else if (frameScheduler.getStats().lastFrameUs > frameScheduler.budget()) {
+        shotOnSlowFrame = false;
+        reason = "slow";
+    }
+    if (reason) {
+        frameScheduler.skip(captureScreen(reason));
+    }
+}
+
+void shotCommand(const char* args) {
+    if (strcmp(args, "slow") == 0) {
+        shotOnSlowFrame = true;
+        Serial.println("Capturing the next frame over budget");
+    } else if (args[0] != '\0') {
+        shotFramesLeft = constrain(atoi(args), 0, SHOT_MAX_FRAMES);
+        Serial.printf("Capturing the next %d frames\n", shotFramesLeft);
+    } else {
+        captureScreen("now");
+    }
+}
+
+// ============================================================================
+// SMOOTH TEXT
+// ============================================================================
+//
+// The question, answers and titles use anti-aliased VLW fonts. Each sits on
+// a flat background the caller names, so glyphs are blended once into the
+// glyph cache and then pushed as plain RGB565 windows (see SmoothFont.h).
+// Everything else keeps the GLCD font.
+
+void smoothFontsBegin() {
+    bool ok = questionFont.begin(fontQuestionVlw, sizeof(fontQuestionVlw));
+    ok &= answerFont.begin(fontAnswerVlw, sizeof(fontAnswerVlw));
+    ok &= titleFont.begin(fontTitleVlw, sizeof(fontTitleVlw));
+    if (!ok) {
+        Serial.println("ERROR: bad font in SmoothFonts.h - re-run tools/make_fonts.py");
+    }
+}
+
+// y is the top of the tallest glyph. Returns the x after the last glyph.
+int drawSmoothText(const SmoothFont& font, const char* text, int x, int y, uint16_t color, uint16_t bg) {
+    TFT_PROFILE_SCOPE();
+    int baseline = y + font.ascent;
+    for (; *text; text++) {
+        uint16_t code = (uint8_t)*text;
+        const SmoothFont::Glyph* g = font.glyph(code);
+        if (!g) {
+            x += font.advanceOf(code);
+            continue;
+        }
+#if DISPLAY_LIST
+        // Starting over would rewrite pixels the list still points at
+        if (glyphCache.mayFlush((uint32_t)g->width * g->height)) displayList.submit();
+#endif
+        const uint16_t* pixels = glyphCache.get(font, *g, color, bg);
+        if (pixels) {
+            pushCachedWindow(x + g->left, baseline - g->top, g->width, g->height, pixels);
+        }
+        x += g->advance;
+    }
+    return x;
+}
+
+void drawSmoothCentered(const SmoothFont& font, const char* text, int y, uint16_t color, uint16_t bg) {
+    drawSmoothText(font, text, (SCREEN_WIDTH - font.textWidth(text)) / 2, y, color, bg);
+}
+
+// Screen headlines - upper case and '!' only (see tools/make_fonts.py)
+void drawTitle(const char* text, int y, uint16_t color, uint16_t bg) {
+    drawSmoothCentered(titleFont, text, y, color, bg);
+}
+
+void reportFonts(const char* args) {
+    if (strcmp(args, "bench") == 0) {
+        // The quiz question both ways, in its box, from an empty cache
+        const char* text = "12 x 12 = ?";
+        fillRoundedRect(20, 30, 280, 85, 15, COLOR_BG_LIGHT);
+        presentFrame();
+        int64_t start = esp_timer_get_time();
+        tft.setTextSize(4);
+        tft.setTextColor(COLOR_WHITE);
+        tft.setCursor((SCREEN_WIDTH - strlen(text) * 24) / 2, 55);
+        tft.print(text);
+        presentFrame();
+        uint32_t glcdUs = esp_timer_get_time() - start;
+
+        glyphCache.clear();
+        uint32_t smoothUs[2];
+        for (int pass = 0; pass < 2; pass++) {
+            fillRoundedRect(20, 30, 280, 85, 15, COLOR_BG_LIGHT);
+            presentFrame();
+            start = esp_timer_get_time();
+            drawSmoothCentered(questionFont, text, 59, COLOR_WHITE, COLOR_BG_LIGHT);
+            presentFrame();
+            smoothUs[pass] = esp_timer_get_time() - start;
+        }
+        screens.redraw();
+        presentFrame();
+
+        Serial.printf("  \"%s\"  glcd size 4: %u us  smooth: %u us first, %u us cached\n",
+                      text, glcdUs, smoothUs[0], smoothUs[1]);
+    }
+
+    GlyphCacheCounters c = glyphCache.takeCounters();
+    Serial.printf("  Glyph cache: %u/%u glyphs, %u/%u pixels\n", glyphCache.entriesUsed(),
+                  GLYPH_CACHE_ENTRIES, glyphCache.pixelsUsed(), GLYPH_CACHE_PIXELS);
+    Serial.printf("  Since last report: %u hits, %u blended, %u flushes\n", c.hits, c.misses, c.flushes);
+}
+
 // ============================================================================
 // SCREEN DRAWING
 // ============================================================================
 
 void drawLauncherScreen() {
+    TFT_PROFILE_SCOPE();
     tft.fillScreen(COLOR_BG);
 
     // Title
-    tft.setTextSize(3);
-    drawCenteredText("MINI GAMES", 15, 3, COLOR_GOLD);
+    drawTitle("MINI GAMES", 15, COLOR_GOLD, COLOR_BG);
 
-    tft.setTextSize(1);
-    drawCenteredText("Select a game to play", 50, 1, COLOR_WHITE);
+    // Who is playing?
+    drawProfilePicker();
 
-    // Game 1: Math Facts - big button
-    fillRoundedRect(30, 75, 260, 70, 15, COLOR_GREEN);
-    tft.setTextSize(3);
-    drawCenteredText("MATH", 85, 3, COLOR_WHITE);
-    drawCenteredText("FACTS", 115, 2, COLOR_WHITE);
+    // Registered games for this page
+    for (int slot = 0; slot < GAMES_PER_PAGE; slot++) {
+        drawLauncherSlot(slot);
+    }
 
-    // Small icon/decoration for Math Facts
+    // Page arrows
+    int numPages = (numGames + GAMES_PER_PAGE - 1) / GAMES_PER_PAGE;
     tft.setTextSize(2);
-    tft.setTextColor(COLOR_YELLOW);
-    tft.setCursor(45, 95);
-    tft.print("123");
-    tft.setCursor(255, 95);
-    tft.print("x");
+    tft.setTextColor(COLOR_WHITE);
+    if (launcherPage > 0) {
+        tft.setCursor(8, 145);
+        tft.print("<");
+    }
+    if (launcherPage < numPages - 1) {
+        tft.setCursor(300, 145);
+        tft.print(">");
+    }
+}
+
+void drawLauncherSlot(int slot) {
+    TFT_PROFILE_SCOPE();
+    int y = 75 + slot * 85;
+    int index = launcherPage * GAMES_PER_PAGE + slot;
 
-    // Game 2: Coming Soon - placeholder button
-    fillRoundedRect(30, 160, 260, 70, 15, 0x4208);  // Gray
+    if (index >= numGames) {
+        // Coming Soon - placeholder button
+        fillRoundedRect(30, y, 260, 70, 15, COLOR_GRAY);
+        tft.setTextSize(2);
+        drawCenteredText("COMING SOON", y + 20, 2, COLOR_LIGHT_GRAY);
+        tft.setTextSize(1);
+        drawCenteredText("More games on the way!", y + 45, 1, 0x6B4D);
+        return;
+    }
+
+    const Minigame* game = games[index];
+    fillRoundedRect(30, y, 260, 70, 15, game->color);
+    drawTitle(game->title, y + 10, COLOR_WHITE, game->color);
+    drawCenteredText(game->subtitle, y + 40, 2, COLOR_WHITE);
+
+    // Small icon/decoration either side
     tft.setTextSize(2);
-    drawCenteredText("COMING SOON", 180, 2, 0x8410);  // Light gray text
-    tft.setTextSize(1);
-    drawCenteredText("More games on the way!", 205, 1, 0x6B4D);
+    tft.setTextColor(COLOR_YELLOW);
+    tft.setCursor(45, y + 20);
+    tft.print(game->iconLeft);
+    tft.setCursor(267 - strlen(game->iconRight) * 12, y + 20);
+    tft.print(game->iconRight);
+}
+
+void drawProfilePicker() {
+    TFT_PROFILE_SCOPE();
+    // Row of profile chips between the title and the game buttons
+    for (int i = 0; i < NUM_PROFILES; i++) {
+        int chipX = 20 + i * 72;
+        tft.fillRect(chipX - 1, 45, 67, 25, COLOR_BG);
+        if (i == activeProfile) {
+            fillRoundedRect(chipX, 46, 65, 22, 6, profileColors[i]);
+            tft.setTextColor(COLOR_BLACK);
+        } else {
+            drawRoundedRect(chipX, 46, 65, 22, 6, profileColors[i]);
+            tft.setTextColor(profileColors[i]);
+        }
+        tft.setTextSize(1);
+        tft.setCursor(chipX + (65 - strlen(profileNames[i]) * 6) / 2, 53);
+        tft.print(profileNames[i]);
+    }
 }
 
 void drawSplashScreen() {
-    tft.fillScreen(COLOR_BG);
+    TFT_PROFILE_SCOPE();
+    drawLayer(LAYER_SPLASH);
 
     // Animated rainbow title
     const char* title = "MATH";
@@ -1254,22 +3441,16 @@ void drawSplashScreen() {
     // Subtitle
     tft.setTextSize(2);
     tft.setTextColor(COLOR_WHITE);
-    drawCenteredText("Times Tables 1-12", 170, 2, COLOR_WHITE);
+    drawCenteredText(factsSubtitle, 170, 2, COLOR_WHITE);
 
     // Touch to start
     tft.setTextSize(1);
     drawCenteredText("Touch anywhere to start!", 210, 1, COLOR_YELLOW);
-
-    // Draw some decorative stars
-    for (int i = 0; i < 15; i++) {
-        int sx = random(0, SCREEN_WIDTH);
-        int sy = random(0, SCREEN_HEIGHT);
-        tft.fillCircle(sx, sy, random(1, 3), rainbowColors[random(0, NUM_RAINBOW_COLORS)]);
-    }
 }
 
 void drawMenuScreen() {
-    tft.fillScreen(COLOR_BG);
+    TFT_PROFILE_SCOPE();
+    drawLayer(LAYER_MENU);
 
     // Back button (top-left)
     tft.setTextSize(1);
@@ -1277,26 +3458,38 @@ void drawMenuScreen() {
     tft.setCursor(5, 5);
     tft.print("< BACK");
 
+    // Active profile (top-right)
+    tft.setTextSize(1);
+    tft.setTextColor(profileColors[activeProfile]);
+    tft.setCursor(SCREEN_WIDTH - 5 - strlen(profileNames[activeProfile]) * 6, 5);
+    tft.print(profileNames[activeProfile]);
+
     // Title
-    tft.setTextSize(3);
-    tft.setTextColor(COLOR_YELLOW);
-    drawCenteredText("MATH FACTS", 20, 3, COLOR_YELLOW);
+    drawTitle("MATH FACTS", 20, COLOR_YELLOW, COLOR_BG);
 
     // Play button
-    fillRoundedRect(60, 80, 200, 70, 15, COLOR_GREEN);
     tft.setTextColor(COLOR_WHITE);
     tft.setTextSize(3);
     tft.setCursor(120, 100);
     tft.print("PLAY!");
 
     // Stats button
-    fillRoundedRect(60, 170, 200, 50, 10, COLOR_CYAN);
     tft.setTextSize(2);
     tft.setCursor(120, 185);
     tft.print("STATS");
 
-    // Show streak if any
-    if (stats.currentStreak > 0) {
+    drawModePicker();
+
+    // Personal best for a speed mode, otherwise the streak
+    if (roundMode == MODE_SPRINT && stats.sprintBestMs > 0) {
+        char bestText[32];
+        sprintf(bestText, "Best sprint: %.1fs", stats.sprintBestMs / 1000.0);
+        drawCenteredText(bestText, 230, 1, COLOR_CYAN);
+    } else if (roundMode == MODE_BLITZ && stats.blitzBest > 0) {
+        char bestText[32];
+        sprintf(bestText, "Best in 60s: %d correct", stats.blitzBest);
+        drawCenteredText(bestText, 230, 1, COLOR_ORANGE);
+    } else if (stats.currentStreak > 0) {
         tft.setTextSize(1);
         tft.setTextColor(COLOR_ORANGE);
         char streakText[32];
@@ -1305,14 +3498,37 @@ void drawMenuScreen() {
     }
 }
 
+void drawModePicker() {
+    TFT_PROFILE_SCOPE();
+    // Row of mode chips under the title
+    for (int i = 0; i < NUM_ROUND_MODES; i++) {
+        int chipX = 20 + i * 97;
+        if (i == roundMode) {
+            fillRoundedRect(chipX, 48, 86, 24, 6, roundModeColors[i]);
+            tft.setTextColor(COLOR_BLACK);
+        } else {
+            drawRoundedRect(chipX, 48, 86, 24, 6, roundModeColors[i]);
+            tft.setTextColor(roundModeColors[i]);
+        }
+        tft.setTextSize(1);
+        tft.setCursor(chipX + (86 - strlen(roundModeNames[i]) * 6) / 2, 56);
+        tft.print(roundModeNames[i]);
+    }
+}
+
 void drawQuizScreen() {
+    TFT_PROFILE_SCOPE();
     tft.fillScreen(COLOR_BG);
 
     // Header with progress and streak
     tft.setTextSize(1);
     tft.setTextColor(COLOR_WHITE);
     tft.setCursor(5, 5);
-    tft.printf("Q: %d/10", stats.questionsThisRound);
+    if (roundLength() > 0) {
+        tft.printf("Q: %d/%d", stats.questionsThisRound, roundLength());
+    } else {
+        tft.printf("Q: %d", stats.questionsThisRound);
+    }
 
     // Show streak with fire if on a streak
     if (stats.currentStreak >= 1) {
@@ -1324,74 +3540,73 @@ void drawQuizScreen() {
         }
     }
 
-    // Round score (correct this round)
-    tft.setTextColor(COLOR_WHITE);
-    tft.setCursor(SCREEN_WIDTH - 50, 5);
-    tft.printf("%d/10", stats.correctThisRound);
+    // Round score (correct this round)
+    tft.setTextColor(COLOR_WHITE);
+    tft.setCursor(SCREEN_WIDTH - 50, 5);
+    if (roundLength() > 0) {
+        tft.printf("%d/%d", stats.correctThisRound, roundLength());
+    } else {
+        tft.printf("%d", stats.correctThisRound);
+    }
+
+    if (roundMode != MODE_CLASSIC) {
+        drawTimerBar();
+    }
+
+    drawQuestionBox(COLOR_BG_LIGHT);
+
+    // Answer buttons (2x2 grid)
+    for (int i = 0; i < 4; i++) {
+        drawAnswerButton(i, buttonColors[i]);
+    }
+
+    // Draw character buddy
+    drawCharacter();
+}
 
-    // Question box
-    fillRoundedRect(20, 30, 280, 85, 15, COLOR_BG_LIGHT);
+// The question on a box of the given color (COLOR_BG_LIGHT, or a step of
+// the correct/wrong pulse)
+void drawQuestionBox(uint16_t bg) {
+    TFT_PROFILE_SCOPE();
+    fillRoundedRect(20, 30, 280, 85, 15, bg);
 
-    // Question text
     char questionText[32];
-    sprintf(questionText, "%d x %d = ?", currentQuestion.num1, currentQuestion.num2);
-
-    tft.setTextSize(4);
-    tft.setTextColor(COLOR_WHITE);
+    sprintf(questionText, "%d %c %d = ?",
+            currentQuestion.num1, currentQuestion.symbol, currentQuestion.num2);
 
-    // Center the question
-    int textWidth = strlen(questionText) * 24;  // Approximate width
-    int textX = (SCREEN_WIDTH - textWidth) / 2;
-    tft.setCursor(textX, 55);
-    tft.print(questionText);
+    // Centered in the box - the font fits "144 / 12 = ?" at one size
+    drawSmoothCentered(questionFont, questionText, 30 + (85 - questionFont.ascent) / 2,
+                       COLOR_WHITE, bg);
+}
 
-    // Answer buttons (2x2 grid)
+void drawAnswerButton(int index, uint16_t color) {
+    TFT_PROFILE_SCOPE();
     int btnWidth = 145;
     int btnHeight = 55;
-    int startX = 10;
-    int startY = 130;
-    int gapX = 10;
-    int gapY = 10;
-
-    for (int i = 0; i < 4; i++) {
-        int col = i % 2;
-        int row = i / 2;
-        int btnX = startX + col * (btnWidth + gapX);
-        int btnY = startY + row * (btnHeight + gapY);
-
-        // Draw button with gradient effect
-        fillRoundedRect(btnX, btnY, btnWidth, btnHeight, 12, buttonColors[i]);
+    int btnX = 10 + (index % 2) * (btnWidth + 10);
+    int btnY = 130 + (index / 2) * (btnHeight + 10);
 
-        // Button text
-        char answerText[8];
-        sprintf(answerText, "%d", currentQuestion.answers[i]);
+    fillRoundedRect(btnX, btnY, btnWidth, btnHeight, 12, color);
 
-        tft.setTextSize(3);
-        tft.setTextColor(COLOR_BLACK);
-
-        // Center text in button
-        int ansLen = strlen(answerText);
-        int ansX = btnX + (btnWidth - ansLen * 18) / 2;
-        int ansY = btnY + (btnHeight - 21) / 2;
-        tft.setCursor(ansX, ansY);
-        tft.print(answerText);
-    }
+    char answerText[8];
+    sprintf(answerText, "%d", currentQuestion.answers[index]);
 
-    // Draw character buddy
-    drawCharacter();
+    // Center text in button
+    int ansX = btnX + (btnWidth - answerFont.textWidth(answerText)) / 2;
+    int ansY = btnY + (btnHeight - answerFont.ascent) / 2;
+    drawSmoothText(answerFont, answerText, ansX, ansY, COLOR_BLACK, color);
 }
 
 void drawResultScreen(bool correct) {
+    TFT_PROFILE_SCOPE();
     // Semi-transparent overlay effect by drawing a darker box
-    fillRoundedRect(30, 30, 260, 80, 15, correct ? COLOR_CORRECT : COLOR_WRONG);
-
-    tft.setTextSize(3);
-    tft.setTextColor(COLOR_WHITE);
+    uint16_t boxColor = correct ? COLOR_CORRECT : COLOR_WRONG;
+    fillRoundedRect(30, 30, 260, 80, 15, boxColor);
 
     if (correct) {
         // Positive message (index set once in checkAnswer)
         const char* messages[] = {"AWESOME!", "GREAT!", "CORRECT!", "PERFECT!", "YES!"};
-        drawCenteredText(messages[feedbackMessageIndex], 50, 3, COLOR_WHITE);
+        drawTitle(messages[feedbackMessageIndex], 50, COLOR_WHITE, boxColor);
 
         // Show streak
         if (stats.currentStreak > 1) {
@@ -1401,12 +3616,12 @@ void drawResultScreen(bool correct) {
             drawCenteredText(streakText, 85, 2, COLOR_YELLOW);
         }
     } else {
-        drawCenteredText("TRY AGAIN!", 45, 3, COLOR_WHITE);
+        drawTitle("TRY AGAIN!", 45, COLOR_WHITE, boxColor);
 
         // Show correct answer
         char correctText[32];
-        sprintf(correctText, "%d x %d = %d",
-                currentQuestion.num1, currentQuestion.num2, currentQuestion.correctAnswer);
+        sprintf(correctText, "%d %c %d = %d", currentQuestion.num1, currentQuestion.symbol,
+                currentQuestion.num2, currentQuestion.correctAnswer);
         tft.setTextSize(2);
         drawCenteredText(correctText, 85, 2, COLOR_WHITE);
     }
@@ -1430,16 +3645,14 @@ void drawResultScreen(bool correct) {
 }
 
 void drawAchievementPopup(int achievementIndex) {
-    tft.fillScreen(COLOR_BG);
+    TFT_PROFILE_SCOPE();
+    drawLayer(LAYER_ACHIEVEMENT);
 
     // Big celebratory text
-    tft.setTextSize(3);
-    tft.setTextColor(COLOR_GOLD);
-    drawCenteredText("ACHIEVEMENT", 20, 3, COLOR_GOLD);
-    drawCenteredText("UNLOCKED!", 55, 3, COLOR_GOLD);
+    drawTitle("ACHIEVEMENT", 20, COLOR_GOLD, COLOR_BG);
+    drawTitle("UNLOCKED!", 55, COLOR_GOLD, COLOR_BG);
 
     // Achievement icon (big)
-    fillRoundedRect(120, 90, 80, 80, 20, COLOR_GOLD);
     tft.setTextSize(4);
     tft.setTextColor(COLOR_BLACK);
     tft.setCursor(145, 110);
@@ -1458,14 +3671,14 @@ void drawAchievementPopup(int achievementIndex) {
 }
 
 void redrawAchievementText(int achievementIndex) {
+    TFT_PROFILE_SCOPE();
     // Redraw just the text portions (to fix star animation erasing text)
     // Don't fill screen - just redraw text with background behind it
 
     // Title text background and text
     tft.fillRect(0, 15, 320, 70, COLOR_BG);
-    tft.setTextSize(3);
-    drawCenteredText("ACHIEVEMENT", 20, 3, COLOR_GOLD);
-    drawCenteredText("UNLOCKED!", 55, 3, COLOR_GOLD);
+    drawTitle("ACHIEVEMENT", 20, COLOR_GOLD, COLOR_BG);
+    drawTitle("UNLOCKED!", 55, COLOR_GOLD, COLOR_BG);
 
     // Icon (redraw the box and icon)
     fillRoundedRect(120, 90, 80, 80, 20, COLOR_GOLD);
@@ -1487,115 +3700,156 @@ void redrawAchievementText(int achievementIndex) {
 }
 
 void drawRoundEndScreen() {
-    tft.fillScreen(COLOR_BG);
-
-    // Get score for this round
-    int score = stats.correctThisRound;
+    TFT_PROFILE_SCOPE();
+    drawLayer(LAYER_ROUND_END);
 
-    // Title based on performance
-    tft.setTextSize(3);
-    if (score == 10) {
-        drawCenteredText("PERFECT!", 20, 3, COLOR_GOLD);
-        startConfetti();
-    } else if (score >= 8) {
-        drawCenteredText("GREAT JOB!", 20, 3, COLOR_GREEN);
-    } else if (score >= 6) {
-        drawCenteredText("GOOD TRY!", 20, 3, COLOR_YELLOW);
-    } else {
-        drawCenteredText("KEEP TRYING!", 20, 3, COLOR_ORANGE);
-    }
+    drawRoundEndTitle();
+    drawRoundEndScore();
+    drawRoundEndTrend();
 
-    // Round complete subtitle
+    // Continue button
     tft.setTextSize(2);
-    drawCenteredText("Round Complete!", 55, 2, COLOR_WHITE);
+    tft.setTextColor(COLOR_WHITE);
+    drawCenteredText("NEXT ROUND", 210, 2, COLOR_WHITE);
 
-    // Big score display
-    fillRoundedRect(80, 85, 160, 80, 20, COLOR_BG_LIGHT);
-    tft.setTextSize(5);
-    char scoreText[8];
-    sprintf(scoreText, "%d/10", score);
-    tft.setTextColor(score >= 8 ? COLOR_GREEN : (score >= 6 ? COLOR_YELLOW : COLOR_ORANGE));
-    int scoreWidth = strlen(scoreText) * 30;
-    tft.setCursor((320 - scoreWidth) / 2, 105);
-    tft.print(scoreText);
+    // Draw character
+    drawCharacter();
+}
 
-    // Stats for this round
-    tft.setTextSize(1);
-    tft.setTextColor(COLOR_WHITE);
-    tft.setCursor(80, 175);
-    tft.printf("Correct: %d  Wrong: %d", score, 10 - score);
+void redrawRoundEndText() {
+    TFT_PROFILE_SCOPE();
+    // Redraw text that confetti may have erased
+    tft.fillRect(0, 15, 320, 45, COLOR_BG);
+    tft.fillRect(0, 50, 320, 25, COLOR_BG);
+    drawRoundEndTitle();
 
-    if (stats.currentStreak > 0) {
-        tft.setCursor(80, 190);
-        tft.printf("Current Streak: %d", stats.currentStreak);
-    }
+    // Score box and stats
+    fillRoundedRect(80, 85, 160, 80, 20, COLOR_BG_LIGHT);
+    tft.fillRect(0, 170, 320, 30, COLOR_BG);
+    drawRoundEndScore();
+
+    // Label and trend lines are re-stroked over themselves, no clearing
+    drawRoundEndTrend();
 
     // Continue button
     fillRoundedRect(60, 205, 200, 30, 10, COLOR_GREEN);
     tft.setTextSize(2);
-    tft.setTextColor(COLOR_WHITE);
     drawCenteredText("NEXT ROUND", 210, 2, COLOR_WHITE);
+}
 
-    // Start character dancing
-    buddy.dancing = true;
-    buddy.dead = false;
-    buddy.frame = 0;
-    buddy.lastFrameTime = millis();
+// The recent rounds beside the score box, under their label
+void drawRoundEndTrend() {
+    tft.setTextSize(1);
+    tft.setTextColor(COLOR_LIGHT_GRAY);
+    tft.setCursor(ROUND_END_TREND_X, 88);
+    tft.print("RECENT");
+    drawTrend(ROUND_END_TREND_X, ROUND_END_TREND_Y);
+}
 
-    // Draw character
-    drawCharacter();
+// Score per round, oldest on the left, as a line through points in each
+// round's mode color. Heights come from roundTrend, worked out when each
+// round was recorded. Draws on top of whatever is there.
+void drawTrend(int x, int y) {
+    TFT_PROFILE_SCOPE();
+    int n = roundHistory.size();
+    if (n == 0) return;
+
+    int prevX = 0, prevY = 0;
+    for (int i = 0; i < n; i++) {
+        int px = x + (n == 1 ? 0 : i * (TREND_W - 1) / (n - 1));
+        int py = y + roundTrend.y(roundHistory, i);
+        if (i > 0) {
+            tft.drawLine(prevX, prevY, px, py, COLOR_LIGHT_GRAY);
+        }
+        prevX = px;
+        prevY = py;
+    }
+    for (int i = 0; i < n; i++) {
+        int px = x + (n == 1 ? 0 : i * (TREND_W - 1) / (n - 1));
+        int py = y + roundTrend.y(roundHistory, i);
+        uint16_t color = roundModeColors[roundHistory.at(i).mode % NUM_ROUND_MODES];
+        if (i == n - 1) {
+            tft.fillCircle(px, py, 2, color);
+        } else {
+            tft.fillRect(px - 1, py - 1, 2, 2, color);
+        }
+    }
 }
 
-void redrawRoundEndText() {
-    // Redraw text that confetti may have erased
+// Headline and subtitle
+void drawRoundEndTitle() {
+    TFT_PROFILE_SCOPE();
     int score = stats.correctThisRound;
 
-    // Title background and text
-    tft.fillRect(0, 15, 320, 45, COLOR_BG);
-    tft.setTextSize(3);
-    if (score == 10) {
-        drawCenteredText("PERFECT!", 20, 3, COLOR_GOLD);
+    if (roundMode != MODE_CLASSIC) {
+        if (speedClock.newBest) {
+            drawTitle("NEW BEST!", 20, COLOR_GOLD, COLOR_BG);
+        } else if (roundMode == MODE_BLITZ) {
+            drawTitle("TIME!", 20, COLOR_ORANGE, COLOR_BG);
+        } else {
+            drawTitle("FINISHED!", 20, COLOR_CYAN, COLOR_BG);
+        }
+    } else if (score == CLASSIC_QUESTIONS) {
+        drawTitle("PERFECT!", 20, COLOR_GOLD, COLOR_BG);
     } else if (score >= 8) {
-        drawCenteredText("GREAT JOB!", 20, 3, COLOR_GREEN);
+        drawTitle("GREAT JOB!", 20, COLOR_GREEN, COLOR_BG);
     } else if (score >= 6) {
-        drawCenteredText("GOOD TRY!", 20, 3, COLOR_YELLOW);
+        drawTitle("GOOD TRY!", 20, COLOR_YELLOW, COLOR_BG);
     } else {
-        drawCenteredText("KEEP TRYING!", 20, 3, COLOR_ORANGE);
+        drawTitle("KEEP TRYING!", 20, COLOR_ORANGE, COLOR_BG);
     }
 
-    // Subtitle
-    tft.fillRect(0, 50, 320, 25, COLOR_BG);
     tft.setTextSize(2);
-    drawCenteredText("Round Complete!", 55, 2, COLOR_WHITE);
+    if (roundMode == MODE_SPRINT) {
+        drawCenteredText("Sprint Complete!", 55, 2, COLOR_WHITE);
+    } else if (roundMode == MODE_BLITZ) {
+        drawCenteredText("Correct in 60s", 55, 2, COLOR_WHITE);
+    } else {
+        drawCenteredText("Round Complete!", 55, 2, COLOR_WHITE);
+    }
+}
 
-    // Score box
-    fillRoundedRect(80, 85, 160, 80, 20, COLOR_BG_LIGHT);
+// Big score in the box, then this round's numbers underneath
+void drawRoundEndScore() {
+    TFT_PROFILE_SCOPE();
+    int score = stats.correctThisRound;
+    int wrong = stats.questionsThisRound - score;
+
+    char scoreText[12];
+    uint16_t scoreColor;
+    if (roundMode == MODE_SPRINT) {
+        sprintf(scoreText, "%.1fs", sprintScoreMs() / 1000.0);
+        scoreColor = speedClock.newBest ? COLOR_GOLD : COLOR_CYAN;
+    } else if (roundMode == MODE_BLITZ) {
+        sprintf(scoreText, "%d", score);
+        scoreColor = speedClock.newBest ? COLOR_GOLD : COLOR_ORANGE;
+    } else {
+        sprintf(scoreText, "%d/%d", score, CLASSIC_QUESTIONS);
+        scoreColor = score >= 8 ? COLOR_GREEN : (score >= 6 ? COLOR_YELLOW : COLOR_ORANGE);
+    }
     tft.setTextSize(5);
-    char scoreText[8];
-    sprintf(scoreText, "%d/10", score);
-    tft.setTextColor(score >= 8 ? COLOR_GREEN : (score >= 6 ? COLOR_YELLOW : COLOR_ORANGE));
+    tft.setTextColor(scoreColor);
     int scoreWidth = strlen(scoreText) * 30;
     tft.setCursor((320 - scoreWidth) / 2, 105);
     tft.print(scoreText);
 
-    // Stats
-    tft.fillRect(0, 170, 320, 30, COLOR_BG);
     tft.setTextSize(1);
     tft.setTextColor(COLOR_WHITE);
     tft.setCursor(80, 175);
-    tft.printf("Correct: %d  Wrong: %d", score, 10 - score);
-    if (stats.currentStreak > 0) {
-        tft.setCursor(80, 190);
+    tft.printf("Correct: %d  Wrong: %d", score, wrong);
+
+    tft.setCursor(80, 190);
+    if (roundMode == MODE_SPRINT) {
+        tft.printf("Best: %.1fs  (+%ds per miss)", stats.sprintBestMs / 1000.0, SPRINT_WRONG_PENALTY_MS / 1000);
+    } else if (roundMode == MODE_BLITZ) {
+        tft.printf("Best: %d correct", stats.blitzBest);
+    } else if (stats.currentStreak > 0) {
         tft.printf("Current Streak: %d", stats.currentStreak);
     }
-
-    // Continue button
-    fillRoundedRect(60, 205, 200, 30, 10, COLOR_GREEN);
-    tft.setTextSize(2);
-    drawCenteredText("NEXT ROUND", 210, 2, COLOR_WHITE);
 }
 
 void drawStatsScreen() {
+    TFT_PROFILE_SCOPE();
     tft.fillScreen(COLOR_BG);
 
     // Back button hint
@@ -1604,6 +3858,30 @@ void drawStatsScreen() {
     tft.setCursor(5, 5);
     tft.print("< Back");
 
+    if (statsPage == 0) {
+        drawStatsSummary();
+    } else if (statsPage == 1) {
+        drawFactsPage();
+    } else {
+        drawAchievementList(statsPage - 2);
+    }
+    drawPageDots(statsPage, STATS_PAGES);
+
+    // Page arrows in the side margins
+    tft.setTextSize(2);
+    tft.setTextColor(COLOR_WHITE);
+    if (statsPage > 0) {
+        tft.setCursor(8, 120);
+        tft.print("<");
+    }
+    if (statsPage < STATS_PAGES - 1) {
+        tft.setCursor(300, 120);
+        tft.print(">");
+    }
+}
+
+void drawStatsSummary() {
+    TFT_PROFILE_SCOPE();
     // Title
     tft.setTextSize(2);
     drawCenteredText("YOUR STATS", 5, 2, COLOR_YELLOW);
@@ -1655,6 +3933,22 @@ void drawStatsScreen() {
     tft.printf("Perfect Rounds: %d", stats.perfectRounds);
     y += lineHeight + 5;
 
+    // Recent rounds, right of the numbers
+    tft.setTextColor(COLOR_YELLOW);
+    tft.setCursor(STATS_TREND_X, 35);
+    tft.print("LAST ROUNDS");
+    if (roundHistory.size() > 0) {
+        drawTrend(STATS_TREND_X, 50);
+        const RoundRecord& last = roundHistory.at(roundHistory.size() - 1);
+        tft.setTextColor(COLOR_WHITE);
+        tft.setCursor(STATS_TREND_X, 50 + TREND_H + 8);
+        tft.printf("Last: %d%% %.1fs", last.percent(), last.avgMs / 1000.0);
+    } else {
+        tft.setTextColor(COLOR_LIGHT_GRAY);
+        tft.setCursor(STATS_TREND_X, 50);
+        tft.print("None yet");
+    }
+
     // Achievements section
     tft.setTextColor(COLOR_YELLOW);
     tft.setTextSize(1);
@@ -1662,48 +3956,362 @@ void drawStatsScreen() {
     tft.print("ACHIEVEMENTS:");
     y += 15;
 
-    // Draw achievement icons
-    int achX = 20;
-    int achY = y;
-    int iconSize = 25;
-    int gap = 5;
-    int perRow = 8;
-
+    // Just the count - the achievements have their own pages
+    int unlockedCount = 0;
     for (int i = 0; i < NUM_ACHIEVEMENTS; i++) {
-        int row = i / perRow;
-        int col = i % perRow;
-        int x = achX + col * (iconSize + gap);
-        int boxY = achY + row * (iconSize + gap);
+        if (achievements[i].unlocked) unlockedCount++;
+    }
 
-        if (achievements[i].unlocked) {
-            fillRoundedRect(x, boxY, iconSize, iconSize, 5, COLOR_GOLD);
-            tft.setTextColor(COLOR_BLACK);
-        } else {
-            fillRoundedRect(x, boxY, iconSize, iconSize, 5, 0x4208);  // Gray
-            tft.setTextColor(0x8410);  // Light gray
-        }
+    tft.setTextColor(COLOR_WHITE);
+    tft.setCursor(20, y);
+    tft.printf("Unlocked: %d/%d", unlockedCount, NUM_ACHIEVEMENTS);
+}
+
+// Name and description of each achievement, a page at a time
+void drawAchievementList(int page) {
+    TFT_PROFILE_SCOPE();
+    drawCenteredText("ACHIEVEMENTS", 5, 2, COLOR_YELLOW);
 
+    int first = page * ACHIEVEMENTS_PER_PAGE;
+    int last = min(first + ACHIEVEMENTS_PER_PAGE, NUM_ACHIEVEMENTS);
+    for (int i = first; i < last; i++) {
+        int y = 32 + (i - first) * 31;
+        bool unlocked = achievements[i].unlocked;
+
+        fillRoundedRect(30, y, 25, 25, 5, unlocked ? COLOR_GOLD : COLOR_GRAY);
         tft.setTextSize(1);
-        tft.setCursor(x + 8, boxY + 8);
+        tft.setTextColor(unlocked ? COLOR_BLACK : COLOR_LIGHT_GRAY);
+        tft.setCursor(38, y + 8);
         tft.print(achievements[i].icon);
+
+        tft.setTextColor(unlocked ? COLOR_WHITE : COLOR_LIGHT_GRAY);
+        tft.setCursor(65, y + 3);
+        tft.print(achievements[i].name);
+        tft.setTextColor(unlocked ? COLOR_YELLOW : COLOR_LIGHT_GRAY);
+        tft.setCursor(65, y + 15);
+        tft.print(achievements[i].description);
     }
+}
 
-    // Count unlocked
-    int unlockedCount = 0;
-    for (int i = 0; i < NUM_ACHIEVEMENTS; i++) {
-        if (achievements[i].unlocked) unlockedCount++;
+// Every fact in this game as a grid colored by mastery, with a key counting
+// the facts at each level
+void drawFactsPage() {
+    TFT_PROFILE_SCOPE();
+    drawCenteredText("FACTS", 5, 2, COLOR_YELLOW);
+
+    tft.setTextSize(1);
+    tft.setTextColor(COLOR_LIGHT_GRAY);
+    for (int i = 0; i < FACT_RANGE; i++) {
+        int n = i + FACT_MIN;
+        int labelWidth = n < 10 ? 6 : 12;
+        int center = i * HEATMAP_PITCH + HEATMAP_CELL / 2;
+        tft.setCursor(HEATMAP_X + center - labelWidth / 2, HEATMAP_Y - 10);
+        tft.print(n);
+        tft.setCursor(HEATMAP_X - 4 - labelWidth, HEATMAP_Y + center - 4);
+        tft.print(n);
+    }
+
+    drawFactHeatmap(HEATMAP_X, HEATMAP_Y);
+
+    int y = HEATMAP_Y + 4;
+    for (int level = NUM_MASTERY_LEVELS - 1; level >= 0; level--) {
+        tft.fillRect(HEATMAP_KEY_X, y, 8, 8, masteryColors[level]);
+        tft.setTextColor(COLOR_WHITE);
+        tft.setCursor(HEATMAP_KEY_X + 12, y);
+        tft.print(masteryNames[level]);
+        tft.setTextColor(COLOR_LIGHT_GRAY);
+        tft.setCursor(HEATMAP_KEY_X + 12, y + 10);
+        tft.print(factMastery.countAt(level));
+        y += 28;
+    }
+}
+
+// Expands rows of the heatmap from the 144 mastery levels into wire-order
+// pixels, HEATMAP_SIZE per line
+void fillHeatmapRows(uint16_t* out, int firstRow, int lines, const uint16_t* wireColors, uint16_t wireGap) {
+    for (int line = 0; line < lines; line++) {
+        int row = firstRow + line;
+        uint16_t* px = out + line * HEATMAP_SIZE;
+        if (row % HEATMAP_PITCH == HEATMAP_CELL) {
+            for (int i = 0; i < HEATMAP_SIZE; i++) *px++ = wireGap;
+            continue;
+        }
+        int first = (row / HEATMAP_PITCH) * FACT_RANGE;
+        for (int col = 0; col < FACT_RANGE; col++) {
+            uint16_t c = wireColors[factMastery.level(first + col)];
+            for (int i = 0; i < HEATMAP_CELL; i++) *px++ = c;
+            *px++ = wireGap;
+        }
+    }
+}
+
+// The whole grid goes out as one address window, built a band at a time in
+// assetBands, instead of 144 fillRects that each set their own window. Like
+// streamImage(), one band fills while DMA sends the other.
+void drawFactHeatmap(int x, int y) {
+    TFT_PROFILE_SCOPE();
+    uint16_t wireColors[NUM_MASTERY_LEVELS];
+    for (int i = 0; i < NUM_MASTERY_LEVELS; i++) {
+        wireColors[i] = (masteryColors[i] >> 8) | (masteryColors[i] << 8);
+    }
+    uint16_t wireGap = (uint16_t)((COLOR_BG >> 8) | (COLOR_BG << 8));
+    const int bandLines = ASSET_BAND_PIXELS / HEATMAP_SIZE;
+
+#if INDEXED_FRAMEBUFFER
+    for (int row = 0; row < HEATMAP_SIZE; row += bandLines) {
+        int lines = min(bandLines, HEATMAP_SIZE - row);
+        fillHeatmapRows(assetBands[0], row, lines, wireColors, wireGap);
+        canvas.pushImage565(x, y + row, HEATMAP_SIZE, lines, assetBands[0]);
+    }
+#else
+#if DISPLAY_LIST
+    displayList.occlude(x, y, HEATMAP_SIZE, HEATMAP_SIZE);
+#endif
+#if TFT_PROFILER
+    int64_t pushStart = esp_timer_get_time();
+#endif
+    display.startWrite();
+    display.setAddrWindow(x, y, HEATMAP_SIZE, HEATMAP_SIZE);
+    int buffer = 0;
+    for (int row = 0; row < HEATMAP_SIZE; row += bandLines) {
+        int lines = min(bandLines, HEATMAP_SIZE - row);
+        fillHeatmapRows(assetBands[buffer], row, lines, wireColors, wireGap);
+        if (displayDma) {
+            display.pushPixelsDMA(assetBands[buffer], lines * HEATMAP_SIZE);
+            buffer ^= 1;
+        } else {
+            display.pushPixels(assetBands[buffer], lines * HEATMAP_SIZE);
+        }
+    }
+    if (displayDma) display.dmaWait();
+    display.endWrite();
+#if TFT_PROFILER
+    profiledTft.recordPush(HEATMAP_SIZE * HEATMAP_SIZE, pushStart);
+#endif
+#endif
+}
+
+void drawPageDots(int page, int numPages) {
+    TFT_PROFILE_SCOPE();
+    int x = SCREEN_WIDTH / 2 - (numPages - 1) * 6;
+    for (int i = 0; i < numPages; i++) {
+        if (i == page) {
+            tft.fillCircle(x + i * 12, 232, 3, COLOR_WHITE);
+        } else {
+            tft.drawCircle(x + i * 12, 232, 3, COLOR_LIGHT_GRAY);
+        }
     }
+}
+
+void drawParentScreen() {
+    TFT_PROFILE_SCOPE();
+    tft.fillScreen(COLOR_BG);
 
+    tft.setTextSize(1);
     tft.setTextColor(COLOR_WHITE);
-    tft.setCursor(20, 220);
-    tft.printf("Unlocked: %d/%d", unlockedCount, NUM_ACHIEVEMENTS);
+    tft.setCursor(5, 5);
+    tft.print("< BACK");
+
+    drawCenteredText("PARENTS", 15, 3, COLOR_YELLOW);
+
+    fillRoundedRect(40, 45, 240, 50, 10, COLOR_CYAN);
+    drawCenteredText("CALIBRATE TOUCH", 63, 2, COLOR_BLACK);
+
+    char resetText[32];
+    snprintf(resetText, sizeof(resetText), "RESET %s", profileNames[activeProfile]);
+    fillRoundedRect(40, 110, 240, 50, 10, COLOR_RED);
+    drawCenteredText(resetText, 128, 2, COLOR_WHITE);
+    drawCenteredText("Double-tap to reset", 167, 1, COLOR_LIGHT_GRAY);
+
+    fillRoundedRect(40, 190, 240, 40, 10, COLOR_GRAY);
+    drawCenteredText("BACK", 203, 2, COLOR_WHITE);
+}
+
+// ============================================================================
+// SCREEN FIXTURES
+// ============================================================================
+//
+// Every screen drawn from fixed state - no clock, no random numbers - so the
+// same build always draws the same pixels. The simulator's golden tests
+// compare them with checked-in images and count what each one sends to the
+// panel. Loading a fixture overwrites the player's stats in RAM.
+
+#if SCREEN_FIXTURES
+// Stats, achievements, fact mastery and round history shared by all of them
+void fixtureStats() {
+    stats = GameStats{0};
+    stats.totalCorrect = 47;
+    stats.totalWrong = 13;
+    stats.currentStreak = 4;
+    stats.bestStreak = 12;
+    stats.perfectRounds = 2;
+    stats.questionsThisRound = 3;
+    stats.correctThisRound = 2;
+    stats.fastestAnswer = 1400;
+    stats.sprintBestMs = 42300;
+    stats.blitzBest = 17;
+
+    for (int i = 0; i < NUM_ACHIEVEMENTS; i++) {
+        achievements[i].unlocked = i < 6;
+        achievements[i].shown = i < 6;
+    }
+
+    // A spread of answers over the facts so every mastery level shows
+    factMastery.clear();
+    for (int i = 0; i < FACT_COUNT; i++) {
+        int mix = (i * 29 + (i / FACT_RANGE) * 7) % 17;
+        int correct = mix % 6;
+        int wrong = (mix / 6) % 3;
+        for (int n = 0; n < correct; n++) factMastery.record(i, true, mix % 4 ? 1500 : 4000);
+        for (int n = 0; n < wrong; n++) factMastery.record(i, false, 0);
+    }
+
+    roundHistory.clear();
+    for (int i = 0; i < 8; i++) {
+        RoundRecord round = {0};
+        round.mode = i % NUM_ROUND_MODES;
+        round.questions = 10;
+        round.correct = (3 + i * 5) % 11;
+        round.avgMs = 2000 + i * 250;
+        roundHistory.append(round);
+    }
+    roundTrend.rebuild(roundHistory);
+
+    roundMode = MODE_CLASSIC;
+    speedClock = SpeedClock{0};
+    launcherPage = 0;
+    statsPage = 0;
+
+    // 7 x 8, with the right answer second
+    currentQuestion = Question{7, 8, 'x', 56, {54, 56, 63, 48}, 1, 7, 6 * FACT_RANGE + 7};
+    selectedAnswer = -1;
+    feedbackMessageIndex = 0;
+
+    buddy = Character{0, 0, 22, 300, false, false, false, 0, 0, 0};
+}
+
+void fixtureSprint() {
+    fixtureStats();
+    roundMode = MODE_SPRINT;
+    speedClock.elapsedUs = 21500000;     // Paused, so the bar holds still
+}
+
+void fixtureRoundEnd() {
+    fixtureStats();
+    stats.questionsThisRound = CLASSIC_QUESTIONS;
+    stats.correctThisRound = 8;
+    buddy.dancing = true;
+}
+
+void fixtureSprintEnd() {
+    fixtureSprint();
+    stats.questionsThisRound = SPRINT_QUESTIONS;
+    stats.correctThisRound = SPRINT_QUESTIONS - 1;
+    stats.sprintBestMs = 21500 + SPRINT_WRONG_PENALTY_MS;
+    speedClock.adjustUs = SPRINT_WRONG_PENALTY_MS * 1000LL;
+    speedClock.newBest = true;
+    buddy.dancing = true;
+}
+
+void fixtureWrong() {
+    fixtureStats();
+    stats.currentStreak = 0;
+}
+
+void fixtureAchievement() {
+    fixtureStats();
+    currentAchievementIndex = 3;
+}
+
+void fixtureStatsPage(int page) {
+    fixtureStats();
+    statsPage = page;
+}
+
+void fixtureFactsPage() { fixtureStatsPage(1); }
+void fixtureAchievementsPage() { fixtureStatsPage(2); }
+void fixtureAchievementsPage2() { fixtureStatsPage(3); }
+
+void drawResultCorrectFixture() {
+    drawQuizScreen();
+    drawResultScreen(true);
+}
+
+void drawResultWrongFixture() {
+    drawQuizScreen();
+    drawResultScreen(false);
+}
+
+void drawAchievementFixture() {
+    drawAchievementPopup(currentAchievementIndex);
+}
+
+struct ScreenFixture {
+    const char* name;
+    void (*load)();
+    void (*draw)();
+};
+
+const ScreenFixture screenFixtures[] = {
+    {"launcher",         fixtureStats,             drawLauncherScreen},
+    {"parent",           fixtureStats,             drawParentScreen},
+    {"splash",           fixtureStats,             drawSplashScreen},
+    {"menu",             fixtureStats,             drawMenuScreen},
+    {"menu_sprint",      fixtureSprint,            drawMenuScreen},
+    {"quiz",             fixtureStats,             drawQuizScreen},
+    {"quiz_sprint",      fixtureSprint,            drawQuizScreen},
+    {"result_correct",   fixtureStats,             drawResultCorrectFixture},
+    {"result_wrong",     fixtureWrong,             drawResultWrongFixture},
+    {"achievement",      fixtureAchievement,       drawAchievementFixture},
+    {"round_end",        fixtureRoundEnd,          drawRoundEndScreen},
+    {"round_end_sprint", fixtureSprintEnd,         drawRoundEndScreen},
+    {"stats",            fixtureStats,             drawStatsScreen},
+    {"stats_facts",      fixtureFactsPage,         drawStatsScreen},
+    {"stats_achieve",    fixtureAchievementsPage,  drawStatsScreen},
+    {"stats_achieve2",   fixtureAchievementsPage2, drawStatsScreen},
+};
+const int numScreenFixtures = sizeof(screenFixtures) / sizeof(screenFixtures[0]);
+
+// nullptr past the last one
+const char* screenFixtureName(int index) {
+    return index >= 0 && index < numScreenFixtures ? screenFixtures[index].name : nullptr;
+}
+
+// Everything up to the draw: Math Facts is entered (its sprites and fonts are
+// needed) and whatever that drew is sent, so the draw can be measured alone
+void loadScreenFixture(int index) {
+    if (activeGame == nullptr) enterGame(0);
+    screenFixtures[index].load();
+    presentFrame();
+}
+
+void drawScreenFixture(int index) {
+    screenFixtures[index].draw();
+    presentFrame();
+}
+
+void fixtureCommand(const char* args) {
+    for (int i = 0; i < numScreenFixtures; i++) {
+        if (strcmp(args, screenFixtures[i].name) == 0) {
+            loadScreenFixture(i);
+            drawScreenFixture(i);
+            return;
+        }
+    }
+    Serial.print("Fixtures:");
+    for (int i = 0; i < numScreenFixtures; i++) {
+        Serial.printf(" %s", screenFixtures[i].name);
+    }
+    Serial.println();
 }
+#endif
 
 // ============================================================================
 // UTILITY FUNCTIONS
 // ============================================================================
 
 void drawCenteredText(const char* text, int y, int size, uint16_t color) {
+    TFT_PROFILE_SCOPE();
     tft.setTextSize(size);
     tft.setTextColor(color);
     int textWidth = strlen(text) * 6 * size;  // Approximate
@@ -1712,39 +4320,197 @@ void drawCenteredText(const char* text, int y, int size, uint16_t color) {
     tft.print(text);
 }
 
+void drawRoundedRect(int x, int y, int w, int h, int r, uint16_t color) {
+    TFT_PROFILE_SCOPE();
+    tft.drawRoundRect(x, y, w, h, r, color);
+}
+
 void fillRoundedRect(int x, int y, int w, int h, int r, uint16_t color) {
+    TFT_PROFILE_SCOPE();
     tft.fillRoundRect(x, y, w, h, r, color);
 }
 
-void drawProgressBar(int x, int y, int w, int h, int value, int maxVal, uint16_t color) {
+// Returns the fill width, for updateProgressBar()
+int drawProgressBar(int x, int y, int w, int h, int value, int maxVal, uint16_t color) {
+    TFT_PROFILE_SCOPE();
     tft.drawRect(x, y, w, h, COLOR_WHITE);
-    int fillWidth = (w - 2) * value / maxVal;
+    int fillWidth = constrain((int)((int64_t)(w - 2) * value / maxVal), 0, w - 2);
     tft.fillRect(x + 1, y + 1, fillWidth, h - 2, color);
+    tft.fillRect(x + 1 + fillWidth, y + 1, w - 2 - fillWidth, h - 2, COLOR_BG);
+    return fillWidth;
 }
 
-void animateCorrect() {
-    // Quick green flash
-    for (int i = 0; i < 3; i++) {
-        tft.fillScreen(COLOR_CORRECT);
-        delay(30);
-        drawQuizScreen();
-        delay(30);
+// Moves a drawn bar to a new value, touching only the columns between the
+// old and new fill. drawnWidth is the fill on screen and is updated.
+void updateProgressBar(int x, int y, int w, int h, int value, int maxVal, uint16_t color, int &drawnWidth) {
+    TFT_PROFILE_SCOPE();
+    int fillWidth = constrain((int)((int64_t)(w - 2) * value / maxVal), 0, w - 2);
+    if (fillWidth < drawnWidth) {
+        tft.fillRect(x + 1 + fillWidth, y + 1, drawnWidth - fillWidth, h - 2, COLOR_BG);
+    } else if (fillWidth > drawnWidth) {
+        tft.fillRect(x + 1 + drawnWidth, y + 1, fillWidth - drawnWidth, h - 2, color);
     }
+    drawnWidth = fillWidth;
+}
+
+void animateCorrect() {
+    // Quick green pulses
+    startQuestionPulse(correctPulse, 2, 15);
 }
 
 void animateWrong() {
-    // Quick shake effect (red flash)
-    for (int i = 0; i < 2; i++) {
-        tft.fillScreen(COLOR_WRONG);
-        delay(50);
-        drawQuizScreen();
-        delay(50);
+    // Slower red pulses
+    startQuestionPulse(wrongPulse, 2, 35);
+}
+
+// Steps the question box through a fade and back, instead of repainting the
+// whole screen in a flash color. Only the box is redrawn - or, with the
+// indexed framebuffer, nothing is: the box's palette entry is stepped. One
+// step per frame from quizUpdate(), so nothing waits in delay() and the
+// flush of each step is part of its frame.
+void startQuestionPulse(const ColorFade& fade, int pulses, int stepMs) {
+    pulseFade = &fade;
+    pulseStep = 0;
+    pulseStepCount = pulses * sizeof(pulseSteps);
+    pulseStepMs = stepMs;
+    pulseNextMs = millis();
+    powerKeepAwake();
+}
+
+// Draws the next step when it is due. Returns true once the last one has
+// had its time on screen.
+bool updateQuestionPulse(unsigned long now) {
+    TFT_PROFILE_SCOPE();
+    powerKeepAwake();
+    if ((long)(now - pulseNextMs) < 0) return false;
+    if (pulseStep == pulseStepCount) {
+        stopQuestionPulse();
+        return true;
+    }
+
+    uint8_t step = pulseSteps[pulseStep % sizeof(pulseSteps)];
+#if INDEXED_FRAMEBUFFER
+    // Only the question box is re-pushed (the area drawQuestionBox() fills)
+    canvas.setPaletteEntry(PALETTE_BG_LIGHT, (*pulseFade)[step], 20, 30, 280, 85);
+#else
+    drawQuestionBox((*pulseFade)[step]);
+#endif
+    // From when the step was due, so late frames don't stretch the pulse
+    pulseStep++;
+    pulseNextMs += pulseStepMs;
+    return false;
+}
+
+void stopQuestionPulse() {
+    if (!pulseFade) return;
+    pulseFade = nullptr;
+#if INDEXED_FRAMEBUFFER
+    canvas.setPaletteEntry(PALETTE_BG_LIGHT, COLOR_BG_LIGHT, 20, 30, 280, 85);
+#endif
+}
+
+// Sends a block of RGB565 pixels (panel byte order) in one windowed write
+void pushWindow(int x, int y, int w, int h, uint16_t* pixels) {
+    TFT_PROFILE_SCOPE();
+#if INDEXED_FRAMEBUFFER
+    canvas.pushImage565(x, y, w, h, pixels);
+#else
+#if DISPLAY_LIST
+    displayList.occlude(x, y, w, h);
+#endif
+#if TFT_PROFILER
+    int64_t pushStart = esp_timer_get_time();
+#endif
+    display.startWrite();
+    display.setAddrWindow(x, y, w, h);
+    display.pushPixels(pixels, w * h);
+    display.endWrite();
+#if TFT_PROFILER
+    profiledTft.recordPush(w * h, pushStart);
+#endif
+#endif
+}
+
+// As pushWindow(), for pixels that stay put until presentFrame() (the glyph
+// cache): the display list records the window instead of sending it now
+void pushCachedWindow(int x, int y, int w, int h, const uint16_t* pixels) {
+#if DISPLAY_LIST
+    displayList.pushWindow(x, y, w, h, pixels);
+#else
+    pushWindow(x, y, w, h, (uint16_t*)pixels);
+#endif
+}
+
+// Shows everything drawn since the last call. Drawing goes straight to the
+// panel unless the indexed framebuffer is on, in which case its dirty bands
+// are pushed now, or the display list is, in which case the recorded calls
+// are trimmed and sent now.
+void presentFrame() {
+#if INDEXED_FRAMEBUFFER
+    canvas.flush();
+#elif DISPLAY_LIST
+    if (displayList.pending() == 0) return;
+    displayList.submit();
+
+    DisplayListCounters c = displayList.takeCounters();
+    DisplayListCounters& total = displayListStats[screens.state()];
+    total.recorded += c.recorded;
+    total.culled += c.culled;
+    total.merged += c.merged;
+    total.submitted += c.submitted;
+    total.bytesCulled += c.bytesCulled;
+    total.bytesMerged += c.bytesMerged;
+    displayListFrames[screens.state()]++;
+#elif TFT_PROFILER
+    profiledTft.endFrame();
+#endif
+}
+
+#if TFT_PROFILER
+const char* currentScreenName() {
+    return screenNames[screens.state()];
+}
+
+// Folded output sits between markers so it can be cut out of a serial log:
+//   sed -n '/^# folded begin/,/^# folded end/{/^#/!p}' log > tft.folded
+void reportProfile(const char* args) {
+    if (strcmp(args, "reset") == 0) {
+        profiledTft.reset();
+        Serial.println("Profile cleared");
+        return;
+    }
+    if (strncmp(args, "folded", 6) == 0) {
+        const char* unit = args[6] == ' ' ? args + 7 : "us";
+        TftFoldedValue value = FOLD_US;
+        if (strcmp(unit, "bytes") == 0) value = FOLD_BYTES;
+        else if (strcmp(unit, "pixels") == 0) value = FOLD_PIXELS;
+        else if (strcmp(unit, "txns") == 0) value = FOLD_TRANSACTIONS;
+
+        Serial.printf("# folded begin (%s)\n", unit);
+        profiledTft.printFolded(Serial, value);
+        Serial.println("# folded end");
+        return;
     }
+    profiledTft.printTable(Serial);
 }
+#endif
+
+#if DISPLAY_LIST
+void reportDisplayList(const char* args) {
+    if (strcmp(args, "reset") == 0) {
+        memset(displayListStats, 0, sizeof(displayListStats));
+        memset(displayListFrames, 0, sizeof(displayListFrames));
+        Serial.println("Display list stats cleared");
+        return;
+    }
 
-uint16_t dimColor(uint16_t color, float factor) {
-    uint8_t r = ((color >> 11) & 0x1F) * factor;
-    uint8_t g = ((color >> 5) & 0x3F) * factor;
-    uint8_t b = (color & 0x1F) * factor;
-    return (r << 11) | (g << 5) | b;
+    Serial.printf("  %-12s %7s %9s %7s %7s %10s %10s\n",
+                  "screen", "frames", "recorded", "culled", "merged", "sent", "bytes saved");
+    for (int i = 0; i < NUM_SCREENS; i++) {
+        const DisplayListCounters& c = displayListStats[i];
+        if (displayListFrames[i] == 0) continue;
+        Serial.printf("  %-12s %7u %9u %7u %7u %10u %10u\n", screenNames[i], displayListFrames[i],
+                      c.recorded, c.culled, c.merged, c.submitted, c.bytesCulled + c.bytesMerged);
+    }
 }
+#endif
@@ -0,0 +1,101 @@
+// color_bench.cpp - Host check and benchmark for include/Color565.h
+//
+// Compares the integer color math against the float per-channel version it
+// replaced (the old dimColor()) and a float blend: worst channel error over
+// every RGB565 color, then the time per call of each.
+//
+// Usage:
+//     g++ -O2 -std=gnu++17 -Iinclude tools/color_bench.cpp -o color_bench && ./color_bench
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "Color565.h"
+
+// ---- Float versions ----
+
+static uint16_t dimColorFloat(uint16_t color, float factor) {
+    uint8_t r = ((color >> 11) & 0x1F) * factor;
+    uint8_t g = ((color >> 5) & 0x3F) * factor;
+    uint8_t b = (color & 0x1F) * factor;
+    return (r << 11) | (g << 5) | b;
+}
+
+static uint16_t lerpFloat(uint16_t from, uint16_t to, float t) {
+    float r = (from >> 11) + ((int)(to >> 11) - (int)(from >> 11)) * t;
+    float g = ((from >> 5) & 0x3F) + ((int)((to >> 5) & 0x3F) - (int)((from >> 5) & 0x3F)) * t;
+    float b = (from & 0x1F) + ((int)(to & 0x1F) - (int)(from & 0x1F)) * t;
+    return ((uint16_t)(r + 0.5f) << 11) | ((uint16_t)(g + 0.5f) << 5) | (uint16_t)(b + 0.5f);
+}
+
+static uint16_t addSatFloat(uint16_t a, uint16_t b) {
+    int r = (a >> 11) + (b >> 11);
+    int g = ((a >> 5) & 0x3F) + ((b >> 5) & 0x3F);
+    int bl = (a & 0x1F) + (b & 0x1F);
+    return ((r > 31 ? 31 : r) << 11) | ((g > 63 ? 63 : g) << 5) | (bl > 31 ? 31 : bl);
+}
+
+// ---- Accuracy ----
+
+static int channelError(uint16_t a, uint16_t b) {
+    int dr = abs((a >> 11) - (b >> 11));
+    int dg = abs(((a >> 5) & 0x3F) - ((b >> 5) & 0x3F));
+    int db = abs((a & 0x1F) - (b & 0x1F));
+    int worst = dr > dg ? dr : dg;
+    return worst > db ? worst : db;
+}
+
+static void checkAccuracy() {
+    int scaleErr = 0, lerpErr = 0, addErr = 0;
+    for (uint32_t c = 0; c <= 0xFFFF; c++) {
+        for (int step = 0; step <= COLOR_FADE_STEPS; step++) {
+            int e = channelError(color565Scale(c, step), dimColorFloat(c, step / 32.0f));
+            if (e > scaleErr) scaleErr = e;
+        }
+        // A spread of second colors rather than all 4 billion pairs
+        for (uint32_t d = (c * 7919) & 0xFFFF, n = 0; n < 16; n++, d = (d * 31 + 17) & 0xFFFF) {
+            for (int step = 0; step <= COLOR_FADE_STEPS; step += 4) {
+                int e = channelError(color565Lerp(c, d, step), lerpFloat(c, d, step / 32.0f));
+                if (e > lerpErr) lerpErr = e;
+            }
+            if (color565AddSat(c, d) != addSatFloat(c, d)) addErr++;
+        }
+    }
+    printf("worst channel error vs float: scale %d, lerp %d (rounding); add-sat mismatches %d\n",
+           scaleErr, lerpErr, addErr);
+}
+
+// ---- Speed ----
+
+template <typename F>
+static double nsPerCall(F f) {
+    const int calls = 1 << 24;
+    volatile uint16_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; i++) sink = sink + f((uint16_t)(i * 40503u), (uint8_t)(i & 31));
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / calls;
+}
+
+int main() {
+    checkAccuracy();
+
+    printf("ns per call (host):\n");
+    printf("  %-22s %8.2f\n", "dimColor (float)",
+           nsPerCall([](uint16_t c, uint8_t s) { return dimColorFloat(c, s / 32.0f); }));
+    printf("  %-22s %8.2f\n", "color565Scale",
+           nsPerCall([](uint16_t c, uint8_t s) { return color565Scale(c, s); }));
+    printf("  %-22s %8.2f\n", "lerp (float)",
+           nsPerCall([](uint16_t c, uint8_t s) { return lerpFloat(c, 0x07E0, s / 32.0f); }));
+    printf("  %-22s %8.2f\n", "color565Lerp",
+           nsPerCall([](uint16_t c, uint8_t s) { return color565Lerp(c, 0x07E0, s); }));
+    static const ColorFade fade = makeColorFade(0x2104, 0x07E0);
+    printf("  %-22s %8.2f\n", "ColorFade lookup",
+           nsPerCall([](uint16_t c, uint8_t s) { return (uint16_t)(fade[s] ^ c); }));
+    printf("  %-22s %8.2f\n", "add-sat (per channel)",
+           nsPerCall([](uint16_t c, uint8_t s) { return addSatFloat(c, s * 0x0841); }));
+    printf("  %-22s %8.2f\n", "color565AddSat",
+           nsPerCall([](uint16_t c, uint8_t s) { return color565AddSat(c, s * 0x0841); }));
+    return 0;
+}
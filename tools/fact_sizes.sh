@@ -0,0 +1,26 @@
+#!/bin/sh
+# fact_sizes.sh - Flash cost of each fact operation
+#
+# Builds the firmware with no operations, then with each one on its own, and
+# prints how many bytes of flash each operation adds. Needs PlatformIO.
+#
+# Usage:
+#     tools/fact_sizes.sh [env]          # default env: esp32-cyd
+
+set -e
+cd "$(dirname "$0")/.."
+ENV="${1:-esp32-cyd}"
+
+flash_used() {
+    PLATFORMIO_BUILD_FLAGS="$1" pio run -e "$ENV" 2>&1 |
+        sed -n 's/^Flash:.*used \([0-9]*\) bytes.*/\1/p'
+}
+
+NONE="-DFACTS_MUL=0 -DFACTS_ADD=0 -DFACTS_SUB=0 -DFACTS_DIV=0"
+BASE=$(flash_used "$NONE")
+echo "no operations: $BASE bytes"
+
+for OP in MUL ADD SUB DIV; do
+    USED=$(flash_used "$NONE -DFACTS_$OP=1")
+    echo "FACTS_$OP: $USED bytes (+$((USED - BASE)))"
+done
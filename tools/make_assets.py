@@ -0,0 +1,259 @@
+#!/usr/bin/env python3
+"""
+make_assets.py - Render static screen layers to RLE-compressed RGB565
+
+The backgrounds of the splash, menu, achievement and round-end screens never
+change, so instead of rebuilding them from primitives on every screen entry
+they are rendered here once and streamed from flash. Text is left to the
+firmware (it depends on game state and TFT_eSPI's built-in font).
+
+Shapes are rasterized with the same algorithms TFT_eSPI uses, so a layer
+matches what the primitive path draws. Colors are read from the COLOR_*
+defines in src/main.cpp.
+
+Usage:
+    python3 tools/make_assets.py          # writes include/ScreenAssets.h
+
+RLE format (one stream per image, row-major, runs may cross rows):
+    control byte c
+      c & 0x80 -> (c & 0x7F) + 1 literal pixels follow, 2 bytes each
+      else     -> c + 1 copies of the next 2-byte pixel
+    Pixels are stored high byte first (panel order), so the decoder can
+    send them without swapping.
+"""
+
+import os
+import random
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MAIN_CPP = os.path.join(ROOT, "src", "main.cpp")
+OUT_HEADER = os.path.join(ROOT, "include", "ScreenAssets.h")
+
+WIDTH = 320
+HEIGHT = 240
+
+
+def load_colors():
+    colors = {}
+    with open(MAIN_CPP) as f:
+        for line in f:
+            m = re.match(r"#define\s+(COLOR_\w+)\s+(0x[0-9A-Fa-f]+)", line)
+            if m:
+                colors[m.group(1)] = int(m.group(2), 16)
+    return colors
+
+
+C = load_colors()
+
+
+# ---- Rasterizer (mirrors TFT_eSPI) ----
+
+class Canvas:
+    def __init__(self, w, h, color):
+        self.w = w
+        self.h = h
+        self.px = [color] * (w * h)
+
+    def hline(self, x, y, w, color):
+        if y < 0 or y >= self.h:
+            return
+        x0 = max(x, 0)
+        x1 = min(x + w, self.w)
+        for i in range(x0, x1):
+            self.px[y * self.w + i] = color
+
+    def fill_rect(self, x, y, w, h, color):
+        for j in range(y, y + h):
+            self.hline(x, j, w, color)
+
+    def fill_circle(self, x0, y0, r, color):
+        x = 0
+        dx = 1
+        dy = r + r
+        p = -(r >> 1)
+        self.hline(x0 - r, y0, dy + 1, color)
+        while x < r:
+            if p >= 0:
+                self.hline(x0 - x, y0 + r, dx, color)
+                self.hline(x0 - x, y0 - r, dx, color)
+                dy -= 2
+                p -= dy
+                r -= 1
+            dx += 2
+            p += dx
+            x += 1
+            self.hline(x0 - r, y0 + x, dy + 1, color)
+            self.hline(x0 - r, y0 - x, dy + 1, color)
+
+    def _fill_circle_helper(self, x0, y0, r, corner, delta, color):
+        f = 1 - r
+        ddf_x = 1
+        ddf_y = -r - r
+        y = 0
+        delta += 1
+        while y < r:
+            if f >= 0:
+                if corner & 1:
+                    self.hline(x0 - y, y0 + r, y + y + delta, color)
+                if corner & 2:
+                    self.hline(x0 - y, y0 - r, y + y + delta, color)
+                r -= 1
+                ddf_y += 2
+                f += ddf_y
+            y += 1
+            ddf_x += 2
+            f += ddf_x
+            if corner & 1:
+                self.hline(x0 - r, y0 + y, r + r + delta, color)
+            if corner & 2:
+                self.hline(x0 - r, y0 - y, r + r + delta, color)
+
+    def fill_round_rect(self, x, y, w, h, r, color):
+        self.fill_rect(x, y + r, w, h - r - r, color)
+        self._fill_circle_helper(x + r, y + h - r - 1, r, 1, w - r - r - 1, color)
+        self._fill_circle_helper(x + r, y + r, r, 2, w - r - r - 1, color)
+
+
+# ---- Layers (keep in step with drawLayerPrimitives() in main.cpp) ----
+
+RAINBOW = ["COLOR_RED", "COLOR_ORANGE", "COLOR_YELLOW", "COLOR_GREEN",
+           "COLOR_CYAN", "COLOR_BLUE", "COLOR_PURPLE", "COLOR_PINK"]
+
+
+def splash_stars():
+    """The 15 decorative stars, fixed so every boot looks the same"""
+    rng = random.Random(15)
+    return [(rng.randrange(WIDTH), rng.randrange(HEIGHT), rng.randrange(1, 3),
+             rng.randrange(len(RAINBOW))) for _ in range(15)]
+
+
+def layer_splash():
+    c = Canvas(WIDTH, HEIGHT, C["COLOR_BG"])
+    for x, y, r, color in splash_stars():
+        c.fill_circle(x, y, r, C[RAINBOW[color]])
+    return c
+
+
+def layer_menu():
+    c = Canvas(WIDTH, HEIGHT, C["COLOR_BG"])
+    c.fill_round_rect(60, 80, 200, 70, 15, C["COLOR_GREEN"])   # PLAY
+    c.fill_round_rect(60, 170, 200, 50, 10, C["COLOR_CYAN"])   # STATS
+    return c
+
+
+def layer_achievement():
+    c = Canvas(WIDTH, HEIGHT, C["COLOR_BG"])
+    c.fill_round_rect(120, 90, 80, 80, 20, C["COLOR_GOLD"])    # Icon box
+    return c
+
+
+def layer_round_end():
+    c = Canvas(WIDTH, HEIGHT, C["COLOR_BG"])
+    c.fill_round_rect(80, 85, 160, 80, 20, C["COLOR_BG_LIGHT"])  # Score box
+    c.fill_round_rect(60, 205, 200, 30, 10, C["COLOR_GREEN"])    # NEXT ROUND
+    return c
+
+
+LAYERS = [
+    ("assetSplash", layer_splash),
+    ("assetMenu", layer_menu),
+    ("assetAchievement", layer_achievement),
+    ("assetRoundEnd", layer_round_end),
+]
+
+
+# ---- Encoder ----
+
+def rle_encode(pixels):
+    out = bytearray()
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:128]
+            del literals[:128]
+            out.append(0x80 | (len(chunk) - 1))
+            for p in chunk:
+                out.extend((p >> 8, p & 0xFF))
+
+    i = 0
+    n = len(pixels)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            flush_literals()
+            out.append(run - 1)
+            out.extend((pixels[i] >> 8, pixels[i] & 0xFF))
+        else:
+            literals.append(pixels[i])
+        i += run
+    flush_literals()
+    return bytes(out)
+
+
+def rle_decode(data, count):
+    pixels = []
+    i = 0
+    while len(pixels) < count:
+        c = data[i]
+        i += 1
+        if c & 0x80:
+            for _ in range((c & 0x7F) + 1):
+                pixels.append((data[i] << 8) | data[i + 1])
+                i += 2
+        else:
+            p = (data[i] << 8) | data[i + 1]
+            i += 2
+            pixels.extend([p] * (c + 1))
+    return pixels
+
+
+def main():
+    images = []
+    for name, build in LAYERS:
+        canvas = build()
+        data = rle_encode(canvas.px)
+        assert rle_decode(data, len(canvas.px)) == canvas.px, name
+        images.append((name, canvas, data))
+
+    lines = [
+        "// ScreenAssets.h - Pre-rendered static screen layers",
+        "//",
+        "// GENERATED by tools/make_assets.py - do not edit. Re-run the script after",
+        "// changing a layer or a COLOR_* define.",
+        "//",
+        "//   layer                 raw bytes   rle bytes",
+    ]
+    for name, canvas, data in images:
+        lines.append("//   %-20s %10d %11d" % (name, canvas.w * canvas.h * 2, len(data)))
+    lines += ["", "#pragma once", "", '#include "RleImage.h"', ""]
+
+    for name, canvas, data in images:
+        lines.append("static const uint8_t %sData[%d] = {" % (name, len(data)))
+        for off in range(0, len(data), 16):
+            lines.append("    " + ", ".join("0x%02X" % b for b in data[off:off + 16]) + ",")
+        lines.append("};")
+        lines.append("static const RleImage %s = {%d, %d, %d, %sData};"
+                     % (name, canvas.w, canvas.h, len(data), name))
+        lines.append("")
+
+    with open(OUT_HEADER, "w") as f:
+        f.write("\n".join(lines).rstrip() + "\n")
+
+    total_raw = 0
+    total_rle = 0
+    for name, canvas, data in images:
+        raw = canvas.w * canvas.h * 2
+        total_raw += raw
+        total_rle += len(data)
+        print("%-20s %7d -> %6d bytes (%.1f%%)" % (name, raw, len(data), 100.0 * len(data) / raw))
+    print("%-20s %7d -> %6d bytes" % ("total", total_raw, total_rle))
+    print("wrote", os.path.relpath(OUT_HEADER, ROOT))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,374 @@
+#!/usr/bin/env python3
+"""
+make_fonts.py - Rasterize a TrueType font into anti-aliased VLW fonts
+
+The question, answers and screen titles use smooth fonts instead of scaled
+GLCD text. Each font is rendered here once, at its final pixel size and only
+for the characters its widget can show, and stored in flash in TFT_eSPI's
+VLW format (so tft.loadFont() can read it too). The firmware's glyph cache
+(include/SmoothFont.h) blends the coverage against the widget's background.
+
+The rasterizer is self-contained: it reads the glyf/loca/cmap/hmtx tables,
+flattens the quadratic outlines and measures coverage with 16x16 samples
+per pixel under the nonzero winding rule. No hinting is applied.
+
+The fonts are Source Code Pro Bold (SIL Open Font License,
+https://github.com/adobe-fonts/source-code-pro).
+
+Usage:
+    python3 tools/make_fonts.py path/to/SourceCodePro-Bold.ttf
+        # writes include/SmoothFonts.h
+
+VLW layout (all integers 32-bit big-endian):
+    header   glyph count, version (11), size in px, 0, ascent, descent
+    metrics  per glyph: code, height, width, x advance, top (dY), left (dX), 0
+    bitmaps  per glyph, in metrics order: width x height coverage bytes
+"""
+
+import os
+import struct
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUT_HEADER = os.path.join(ROOT, "include", "SmoothFonts.h")
+
+SAMPLES = 16        # Sub-samples per pixel along each axis
+CURVE_STEPS = 8     # Line segments per quadratic curve
+
+# name, pixel size, characters (keep in step with the text drawn in main.cpp)
+FONTS = [
+    ("fontQuestion", 36, "0123456789 +-x/=?"),
+    ("fontAnswer", 32, "0123456789-"),
+    ("fontTitle", 30, " !ABCDEFGHIJKLMNOPQRSTUVWXYZ"),
+]
+
+
+# ---- TrueType tables ----
+
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        self.tables = {}
+        num_tables = struct.unpack_from(">H", self.data, 4)[0]
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack_from(">4sIII", self.data, 12 + 16 * i)
+            self.tables[tag.decode("latin-1")] = (offset, length)
+        for tag in ("head", "hhea", "hmtx", "maxp", "cmap", "loca", "glyf"):
+            if tag not in self.tables:
+                raise ValueError("%s: no '%s' table (CFF fonts are not supported)" % (path, tag))
+
+        head = self.tables["head"][0]
+        self.units_per_em = struct.unpack_from(">H", self.data, head + 18)[0]
+        self.long_loca = struct.unpack_from(">h", self.data, head + 50)[0] == 1
+        self.num_glyphs = struct.unpack_from(">H", self.data, self.tables["maxp"][0] + 4)[0]
+        self.num_hmetrics = struct.unpack_from(">H", self.data, self.tables["hhea"][0] + 34)[0]
+        self.cmap = self._read_cmap()
+
+    def _read_cmap(self):
+        base = self.tables["cmap"][0]
+        count = struct.unpack_from(">H", self.data, base + 2)[0]
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from(">HHI", self.data, base + 4 + 8 * i)
+            sub = base + offset
+            if platform == 3 and encoding == 1 and struct.unpack_from(">H", self.data, sub)[0] == 4:
+                return self._read_format4(sub)
+        raise ValueError("no Unicode BMP (3,1) format 4 cmap")
+
+    def _read_format4(self, sub):
+        seg_x2 = struct.unpack_from(">H", self.data, sub + 6)[0]
+        ends = sub + 14
+        starts = ends + seg_x2 + 2
+        deltas = starts + seg_x2
+        ranges = deltas + seg_x2
+        mapping = {}
+        for s in range(seg_x2 // 2):
+            end = struct.unpack_from(">H", self.data, ends + 2 * s)[0]
+            start = struct.unpack_from(">H", self.data, starts + 2 * s)[0]
+            delta = struct.unpack_from(">h", self.data, deltas + 2 * s)[0]
+            range_offset = struct.unpack_from(">H", self.data, ranges + 2 * s)[0]
+            if start > 0x7E:
+                continue
+            for code in range(start, min(end, 0x7E) + 1):
+                if range_offset == 0:
+                    glyph = (code + delta) & 0xFFFF
+                else:
+                    at = ranges + 2 * s + range_offset + 2 * (code - start)
+                    glyph = struct.unpack_from(">H", self.data, at)[0]
+                    if glyph:
+                        glyph = (glyph + delta) & 0xFFFF
+                mapping[code] = glyph
+        return mapping
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"][0]
+        index = min(glyph, self.num_hmetrics - 1)
+        return struct.unpack_from(">H", self.data, hmtx + 4 * index)[0]
+
+    def _glyph_range(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            start, end = struct.unpack_from(">II", self.data, loca + 4 * glyph)
+        else:
+            start, end = (2 * v for v in struct.unpack_from(">HH", self.data, loca + 2 * glyph))
+        glyf = self.tables["glyf"][0]
+        return glyf + start, end - start
+
+    def contours(self, glyph):
+        """Outline as closed contours of (x, y, on_curve) points, font units"""
+        offset, length = self._glyph_range(glyph)
+        if length == 0:
+            return []
+        num_contours = struct.unpack_from(">h", self.data, offset)[0]
+        if num_contours < 0:
+            return self._composite(offset + 10)
+        return self._simple(offset + 10, num_contours)
+
+    def _simple(self, p, num_contours):
+        ends = struct.unpack_from(">%dH" % num_contours, self.data, p)
+        p += 2 * num_contours
+        num_points = ends[-1] + 1 if num_contours else 0
+        p += 2 + struct.unpack_from(">H", self.data, p)[0]  # Skip instructions
+
+        flags = []
+        while len(flags) < num_points:
+            flag = self.data[p]
+            p += 1
+            flags.append(flag)
+            if flag & 8:
+                flags.extend([flag] * self.data[p])
+                p += 1
+
+        def coords(short_bit, same_bit):
+            nonlocal p
+            values = []
+            value = 0
+            for flag in flags:
+                if flag & short_bit:
+                    delta = self.data[p]
+                    p += 1
+                    value += delta if flag & same_bit else -delta
+                elif not flag & same_bit:
+                    value += struct.unpack_from(">h", self.data, p)[0]
+                    p += 2
+                values.append(value)
+            return values
+
+        xs = coords(2, 16)
+        ys = coords(4, 32)
+        contours = []
+        start = 0
+        for end in ends:
+            contours.append([(xs[i], ys[i], flags[i] & 1) for i in range(start, end + 1)])
+            start = end + 1
+        return contours
+
+    def _composite(self, p):
+        contours = []
+        while True:
+            flags, glyph = struct.unpack_from(">HH", self.data, p)
+            p += 4
+            if flags & 1:
+                dx, dy = struct.unpack_from(">hh", self.data, p)
+                p += 4
+            else:
+                dx, dy = struct.unpack_from(">bb", self.data, p)
+                p += 2
+            if not flags & 2:
+                raise ValueError("point-matched composite glyphs are not supported")
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 8:
+                a = d = struct.unpack_from(">h", self.data, p)[0] / 16384.0
+                p += 2
+            elif flags & 0x40:
+                a, d = (v / 16384.0 for v in struct.unpack_from(">hh", self.data, p))
+                p += 4
+            elif flags & 0x80:
+                a, b, c, d = (v / 16384.0 for v in struct.unpack_from(">hhhh", self.data, p))
+                p += 8
+            for contour in self.contours(glyph):
+                contours.append([(a * x + c * y + dx, b * x + d * y + dy, on)
+                                 for x, y, on in contour])
+            if not flags & 0x20:
+                return contours
+
+
+# ---- Rasterizer ----
+
+def flatten(contour):
+    """Closed polygon from a contour with implied on-curve midpoints"""
+    points = []
+    n = len(contour)
+    for i in range(n):
+        x, y, on = contour[i]
+        nx, ny, non = contour[(i + 1) % n]
+        if on:
+            points.append(("on", x, y))
+        else:
+            points.append(("off", x, y))
+            if not non:
+                points.append(("on", (x + nx) / 2.0, (y + ny) / 2.0))
+
+    # Start from an on-curve point
+    first = next(i for i, p in enumerate(points) if p[0] == "on")
+    points = points[first:] + points[:first]
+
+    poly = []
+    i = 0
+    n = len(points)
+    while i < n:
+        _, x0, y0 = points[i]
+        poly.append((x0, y0))
+        kind, cx, cy = points[(i + 1) % n]
+        if kind == "off":
+            _, x1, y1 = points[(i + 2) % n]
+            for step in range(1, CURVE_STEPS):
+                t = step / float(CURVE_STEPS)
+                u = 1 - t
+                poly.append((u * u * x0 + 2 * u * t * cx + t * t * x1,
+                             u * u * y0 + 2 * u * t * cy + t * t * y1))
+            i += 2
+        else:
+            i += 1
+    return poly
+
+
+def rasterize(polygons, width, height):
+    """Coverage 0-255 per pixel; polygons are in pixels, y down"""
+    edges = []
+    for poly in polygons:
+        for i in range(len(poly)):
+            x0, y0 = poly[i]
+            x1, y1 = poly[(i + 1) % len(poly)]
+            if y0 != y1:
+                edges.append((x0, y0, x1, y1, 1 if y1 > y0 else -1))
+
+    sub_w = width * SAMPLES
+    coverage = [0] * (width * height)
+    for sy in range(height * SAMPLES):
+        y = (sy + 0.5) / SAMPLES
+        crossings = []
+        for x0, y0, x1, y1, winding in edges:
+            if min(y0, y1) <= y < max(y0, y1):
+                crossings.append((x0 + (y - y0) * (x1 - x0) / (y1 - y0), winding))
+        if not crossings:
+            continue
+        crossings.sort()
+
+        row = (sy // SAMPLES) * width
+        winding = 0
+        for k in range(len(crossings) - 1):
+            winding += crossings[k][1]
+            if winding == 0:
+                continue
+            # Sub-samples whose centers fall inside the span
+            s0 = max(int(crossings[k][0] * SAMPLES + 0.5), 0)
+            s1 = min(int(crossings[k + 1][0] * SAMPLES + 0.5), sub_w)
+            for s in range(s0, s1):
+                coverage[row + s // SAMPLES] += 1
+
+    full = SAMPLES * SAMPLES
+    return [min(255, (c * 255 + full // 2) // full) for c in coverage]
+
+
+def render_glyph(font, code, size):
+    scale = size / float(font.units_per_em)
+    glyph = font.cmap.get(ord(code), 0)
+    advance = int(round(font.advance(glyph) * scale))
+
+    polygons = [flatten(c) for c in font.contours(glyph) if c]
+    if not polygons:
+        return advance, 0, 0, 0, 0, []
+
+    xs = [x for poly in polygons for x, _ in poly]
+    ys = [y for poly in polygons for _, y in poly]
+    left = int(min(xs) * scale) - (1 if min(xs) < 0 else 0)
+    right = int(max(xs) * scale + 0.999) + 1
+    top = int(max(ys) * scale + 0.999) + 1
+    bottom = int(min(ys) * scale) - 1
+    width = right - left
+    height = top - bottom
+
+    # Font units, y up -> bitmap pixels, y down
+    pixel_polys = [[(x * scale - left, top - y * scale) for x, y in poly] for poly in polygons]
+    alpha = rasterize(pixel_polys, width, height)
+
+    # Trim empty border rows and columns
+    rows = [r for r in range(height) if any(alpha[r * width:(r + 1) * width])]
+    cols = [c for c in range(width) if any(alpha[r * width + c] for r in range(height))]
+    if not rows:
+        return advance, 0, 0, 0, 0, []
+    r0, r1, c0, c1 = rows[0], rows[-1] + 1, cols[0], cols[-1] + 1
+    trimmed = [alpha[r * width + c] for r in range(r0, r1) for c in range(c0, c1)]
+    return advance, c1 - c0, r1 - r0, top - r0, left + c0, trimmed
+
+
+def build_vlw(font, size, chars):
+    glyphs = []
+    for code in sorted(set(chars)):
+        advance, w, h, dy, dx, alpha = render_glyph(font, code, size)
+        glyphs.append((ord(code), w, h, advance, dy, dx, alpha))
+
+    ascent = max(g[4] for g in glyphs)
+    descent = max(g[2] - g[4] for g in glyphs)
+
+    out = bytearray(struct.pack(">6i", len(glyphs), 11, size, 0, ascent, descent))
+    for code, w, h, advance, dy, dx, _ in glyphs:
+        out += struct.pack(">7i", code, h, w, advance, dy, dx, 0)
+    for glyph in glyphs:
+        out += bytes(glyph[6])
+    return bytes(out), glyphs, ascent, descent
+
+
+def preview(glyphs, code):
+    for c, w, h, _, _, _, alpha in glyphs:
+        if c == ord(code):
+            shades = " .:-=+*#%@"
+            for r in range(h):
+                print("    " + "".join(shades[alpha[r * w + i] * 9 // 255] for i in range(w)))
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__.strip().split("Usage:")[1].split("VLW layout")[0].rstrip())
+        return 1
+    ttf_path = sys.argv[1]
+    font = TrueType(ttf_path)
+
+    built = []
+    for name, size, chars in FONTS:
+        data, glyphs, ascent, descent = build_vlw(font, size, chars)
+        built.append((name, size, chars, data, ascent, descent))
+        print("%-14s %3d px  %2d glyphs  ascent %2d  descent %2d  %6d bytes"
+              % (name, size, len(glyphs), ascent, descent, len(data)))
+        preview(glyphs, chars[0])
+
+    lines = [
+        "// SmoothFonts.h - Anti-aliased VLW fonts for the question, answers and titles",
+        "//",
+        "// GENERATED by tools/make_fonts.py - do not edit. Re-run the script after",
+        "// changing a size or the characters a widget shows.",
+        "//",
+        "// Source: %s" % os.path.basename(ttf_path),
+        "//",
+        "//   font           px  ascent descent   bytes  characters",
+    ]
+    for name, size, chars, data, ascent, descent in built:
+        lines.append("//   %-13s %3d %7d %7d %7d  \"%s\"" % (name, size, ascent, descent, len(data), chars))
+    lines += ["", "#pragma once", "", "#include <stdint.h>", ""]
+
+    for name, size, chars, data, ascent, descent in built:
+        lines.append("static const uint8_t %sVlw[%d] = {" % (name, len(data)))
+        for off in range(0, len(data), 16):
+            lines.append("    " + ", ".join("0x%02X" % b for b in data[off:off + 16]) + ",")
+        lines.append("};")
+        lines.append("")
+
+    with open(OUT_HEADER, "w") as f:
+        f.write("\n".join(lines).rstrip() + "\n")
+    print("wrote", os.path.relpath(OUT_HEADER, ROOT))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+"""
+qemu_run.py - Boot the firmware under Espressif's ESP32 QEMU and drive it
+
+Builds a 4 MB flash image from the esp32-cyd-qemu build, starts QEMU with
+the UART on a pipe, and plays a script against the serial console: waiting
+for log lines, typing commands, and tapping the screen with the firmware's
+'tap'/'swipe' commands. Everything the firmware prints is echoed (and kept
+with --log), then the lines worth comparing between runs are summarized:
+the boot timeline, frame times and cycles, and what saving cost.
+
+QEMU has no model for the panel or the touch controller. SPI writes to the
+display land in the emulated SPI controller and go nowhere; the
+esp32-cyd-qemu build never reads the XPT2046 and leaves out light sleep and
+I2S, which QEMU doesn't emulate either.
+
+Times are the emulator's, not the board's: use them to compare builds on
+the same machine, not as real milliseconds. With --icount the clock follows
+instructions executed, so runs repeat exactly and cycle counts are exact.
+
+Usage:
+    pio run -e esp32-cyd-qemu
+    python3 tools/qemu_run.py [--script FILE] [--icount N] [--log FILE]
+
+Needs qemu-system-xtensa from Espressif's QEMU fork on the PATH (or
+--qemu PATH). boot_app0.bin is optional - with blank OTA data the
+bootloader starts app0 anyway.
+
+Script lines (# starts a comment):
+    wait TEXT [SECONDS]     until a line containing TEXT is printed
+    send LINE               type a serial command
+    tap X Y                 'tap X Y', then let it play out
+    swipe X0 Y0 X1 Y1       'swipe ...', then let it play out
+    sleep MS
+    answer N                answer N questions with the top-left button,
+                            tapping through any achievement popup
+"""
+
+import argparse
+import glob
+import os
+import queue
+import re
+import subprocess
+import sys
+import threading
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+BUILD_DIR = os.path.join(ROOT, ".pio", "build", "esp32-cyd-qemu")
+FLASH_SIZE = 4 * 1024 * 1024
+
+# Offsets as in the web flasher's manifest
+IMAGE_PARTS = [
+    (0x1000, "bootloader.bin"),
+    (0x8000, "partitions.bin"),
+    (0xE000, "boot_app0.bin"),
+    (0x10000, "firmware.bin"),
+]
+
+# One classic round on the first game, then the reports
+DEFAULT_SCRIPT = """
+wait BOOT first_frame_ms 60
+send frames reset
+tap 160 110          # Launcher: first game
+sleep 1500
+tap 160 120          # Splash
+sleep 1000
+tap 160 120          # Menu: PLAY
+answer 10
+wait Round: 30
+sleep 1000
+send frames
+send nvs
+send layers
+"""
+
+ANSWER_X, ANSWER_Y = 80, 155        # Top-left answer button
+POPUP_TAP = (160, 120)
+TOUCH_SETTLE_S = 0.4                # Longer than a tap or swipe takes to play
+
+
+def find_boot_app0():
+    pattern = os.path.expanduser("~/.platformio/packages/framework-arduinoespressif32*/tools/partitions/boot_app0.bin")
+    found = glob.glob(pattern)
+    return found[0] if found else None
+
+
+def make_flash_image(build_dir, out_path):
+    image = bytearray(b"\xff" * FLASH_SIZE)
+    for offset, name in IMAGE_PARTS:
+        path = os.path.join(build_dir, name)
+        if not os.path.exists(path) and name == "boot_app0.bin":
+            path = find_boot_app0()
+            if path is None:
+                continue
+        if not os.path.exists(path):
+            sys.exit(f"{path} not found - run 'pio run -e esp32-cyd-qemu' first")
+        with open(path, "rb") as f:
+            data = f.read()
+        image[offset:offset + len(data)] = data
+    with open(out_path, "wb") as f:
+        f.write(image)
+
+
+class Firmware:
+    """QEMU with the firmware's UART on stdin/stdout"""
+
+    def __init__(self, qemu, flash_path, icount, log):
+        cmd = [qemu, "-machine", "esp32", "-display", "none",
+               "-drive", f"file={flash_path},if=mtd,format=raw",
+               "-global", "driver=timer.esp32.timg,property=wdt_disable,value=true",
+               "-serial", "stdio", "-monitor", "none"]
+        if icount is not None:
+            cmd += ["-icount", str(icount)]
+        self.proc = subprocess.Popen(cmd, stdin=subprocess.PIPE, stdout=subprocess.PIPE,
+                                     stderr=subprocess.STDOUT)
+        self.lines = queue.Queue()
+        self.log = log
+        self.seen = []
+        self.cursor = 0                 # wait() only matches lines from here on
+        threading.Thread(target=self._read, daemon=True).start()
+
+    def _read(self):
+        for raw in self.proc.stdout:
+            line = raw.decode("utf-8", "replace").rstrip("\r\n")
+            self.lines.put(line)
+        self.lines.put(None)
+
+    def _take(self, timeout):
+        line = self.lines.get(timeout=timeout)
+        if line is None:
+            raise RuntimeError("QEMU exited")
+        print(line)
+        if self.log:
+            self.log.write(line + "\n")
+        self.seen.append(line)
+        return line
+
+    def wait(self, text, seconds, nudge=None):
+        """True once a line containing text has been printed since the last
+        match, including lines already echoed by drain(). nudge (x, y) is
+        tapped whenever nothing has been printed for a while."""
+        deadline = time.monotonic() + seconds
+        while True:
+            for i in range(self.cursor, len(self.seen)):
+                if text in self.seen[i]:
+                    self.cursor = i + 1
+                    return True
+            self.cursor = len(self.seen)
+            if time.monotonic() >= deadline:
+                return False
+            try:
+                self._take(min(2.0, deadline - time.monotonic()))
+                self.cursor = len(self.seen) - 1
+            except queue.Empty:
+                if nudge:
+                    self.send(f"tap {nudge[0]} {nudge[1]}")
+
+    def drain(self, seconds):
+        deadline = time.monotonic() + seconds
+        while time.monotonic() < deadline:
+            try:
+                self._take(deadline - time.monotonic())
+            except queue.Empty:
+                break
+
+    def send(self, line):
+        self.proc.stdin.write((line + "\n").encode())
+        self.proc.stdin.flush()
+
+    def stop(self):
+        self.proc.kill()
+        self.proc.wait()
+
+
+def run_script(fw, script):
+    for number, raw in enumerate(script.splitlines(), 1):
+        line = raw.split("#", 1)[0].strip()
+        if not line:
+            continue
+        op, _, rest = line.partition(" ")
+        args = rest.split()
+
+        if op == "wait":
+            text = rest.rsplit(" ", 1)
+            seconds = 30
+            if len(text) == 2 and text[1].isdigit():
+                rest, seconds = text[0], int(text[1])
+            if not fw.wait(rest, seconds):
+                sys.exit(f"script line {number}: no '{rest}' within {seconds} s")
+        elif op == "send":
+            fw.send(rest)
+            fw.drain(0.5)
+        elif op in ("tap", "swipe"):
+            fw.send(line)
+            fw.drain(TOUCH_SETTLE_S)
+        elif op == "sleep":
+            fw.drain(int(args[0]) / 1000)
+        elif op == "answer":
+            for _ in range(int(args[0])):
+                if not fw.wait("Question:", 30, nudge=POPUP_TAP):
+                    sys.exit(f"script line {number}: no question came up")
+                fw.drain(TOUCH_SETTLE_S)
+                fw.send(f"tap {ANSWER_X} {ANSWER_Y}")
+        else:
+            sys.exit(f"script line {number}: unknown '{op}'")
+
+
+SUMMARY_PATTERNS = [
+    r"^BOOT ",
+    r"^  \S+ +[\d.]+  \(\+[\d.]+\)$",      # Boot timeline stages
+    r"^Frames:",
+    r"^  (last / worst|cycles|overruns):",
+    r"^Round:",
+    r"^Saves:",
+    r"^  (time|entries):",
+]
+
+
+def summarize(lines):
+    print("\n=== Summary ===")
+    for line in lines:
+        if any(re.search(p, line) for p in SUMMARY_PATTERNS):
+            print(line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("--build-dir", default=BUILD_DIR)
+    parser.add_argument("--qemu", default="qemu-system-xtensa")
+    parser.add_argument("--script", help="script file (default: one classic round)")
+    parser.add_argument("--icount", type=int, help="QEMU -icount shift, for repeatable timing")
+    parser.add_argument("--log", help="also write the serial output here")
+    args = parser.parse_args()
+
+    script = DEFAULT_SCRIPT
+    if args.script:
+        with open(args.script) as f:
+            script = f.read()
+
+    flash_path = os.path.join(args.build_dir, "qemu_flash.bin")
+    make_flash_image(args.build_dir, flash_path)
+
+    log = open(args.log, "w") if args.log else None
+    fw = Firmware(args.qemu, flash_path, args.icount, log)
+    try:
+        run_script(fw, script)
+        fw.drain(1.0)
+    finally:
+        fw.stop()
+        if log:
+            log.close()
+    summarize(fw.seen)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""
+screenshot.py - Turn the firmware's 'shot' captures into PNG files
+
+'shot' reads the panel's memory back and prints it as base64 lines of RLE
+(the same format as the screen assets, see include/RleImage.h) between
+'# shot begin' and '# shot end' markers. This tool finds those blocks in
+a live serial port or in a saved log, decodes each one and writes a PNG.
+It also prints the frame number and timestamps, so captures from
+'shot N' or 'shot slow' can be lined up with the frame times.
+
+Usage:
+    python3 tools/screenshot.py --port /dev/ttyUSB0                 # 'shot' now
+    python3 tools/screenshot.py --port /dev/ttyUSB0 --send "shot 5" --count 5
+    python3 tools/screenshot.py --port /dev/ttyUSB0 --send "shot slow" --timeout 60
+    python3 tools/screenshot.py serial.log                          # from a log
+    build-sim/cyd-sim --headless --script s.txt | python3 tools/screenshot.py -
+
+--port needs pyserial. PNGs are written to --out as
+shot-<frame>-<reason>.png.
+"""
+
+import argparse
+import base64
+import os
+import re
+import struct
+import sys
+import time
+import zlib
+
+BEGIN = re.compile(r"# shot begin (\d+)x(\d+) frame=(\d+) t_us=(-?\d+) frame_us=(\d+) reason=(\w+)")
+END = re.compile(r"# shot end bytes=(\d+) read_us=(\d+) total_us=(\d+)")
+
+
+def rle_decode(data, count):
+    pixels = []
+    i = 0
+    while len(pixels) < count and i < len(data):
+        c = data[i]
+        i += 1
+        if c & 0x80:
+            for _ in range((c & 0x7F) + 1):
+                pixels.append((data[i] << 8) | data[i + 1])
+                i += 2
+        else:
+            p = (data[i] << 8) | data[i + 1]
+            i += 2
+            pixels.extend([p] * (c + 1))
+    return pixels
+
+
+def write_png(path, pixels, w, h):
+    raw = bytearray()
+    for y in range(h):
+        raw.append(0)
+        for p in pixels[y * w:(y + 1) * w]:
+            r, g, b = p >> 11, (p >> 5) & 0x3F, p & 0x1F
+            raw.extend(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)))
+
+    def chunk(kind, data):
+        body = kind + data
+        return struct.pack(">I", len(data)) + body + struct.pack(">I", zlib.crc32(body))
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", w, h, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+class Collector:
+    """Feeds on lines; saves a PNG at each complete capture"""
+
+    def __init__(self, out_dir):
+        self.out_dir = out_dir
+        self.header = None
+        self.data = bytearray()
+        self.saved = 0
+        self.last_t_us = None
+
+    def feed(self, line):
+        line = line.strip()
+        m = BEGIN.match(line)
+        if m:
+            self.header = m
+            self.data = bytearray()
+            return
+        if self.header is None:
+            return
+        m = END.match(line)
+        if m:
+            self.finish(m)
+            self.header = None
+            return
+        try:
+            self.data.extend(base64.b64decode(line, validate=True))
+        except ValueError:
+            # Anything else printed mid-capture spoils it
+            print(f"shot: frame {self.header.group(3)} broken by '{line[:40]}' - skipped")
+            self.header = None
+
+    def finish(self, end):
+        w, h = int(self.header.group(1)), int(self.header.group(2))
+        frame, t_us, frame_us = int(self.header.group(3)), int(self.header.group(4)), int(self.header.group(5))
+        reason = self.header.group(6)
+        size, read_us, total_us = int(end.group(1)), int(end.group(2)), int(end.group(3))
+        if len(self.data) != size:
+            print(f"shot: frame {frame} got {len(self.data)} of {size} bytes - skipped")
+            return
+        pixels = rle_decode(self.data, w * h)
+        if len(pixels) != w * h:
+            print(f"shot: frame {frame} decoded {len(pixels)} of {w * h} pixels - skipped")
+            return
+
+        path = os.path.join(self.out_dir, f"shot-{frame}-{reason}.png")
+        write_png(path, pixels[:w * h], w, h)
+        self.saved += 1
+
+        since = f"  +{(t_us - self.last_t_us) / 1000:.1f} ms" if self.last_t_us is not None else ""
+        self.last_t_us = t_us
+        print(f"{path}: frame {frame} at {t_us / 1e6:.3f} s{since}, frame took {frame_us / 1000:.1f} ms; "
+              f"{size} bytes ({100.0 * size / (w * h * 2):.1f}%), read {read_us / 1000:.1f} ms, "
+              f"capture {total_us / 1000:.1f} ms")
+
+
+def from_port(args, collector):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("--port needs pyserial (pip install pyserial)")
+
+    with serial.Serial(args.port, args.baud, timeout=0.2) as port:
+        # A dark screen takes the first characters to wake up (see 'power')
+        port.write(b"\n")
+        time.sleep(0.2)
+        port.reset_input_buffer()
+        port.write(args.send.encode() + b"\n")
+
+        deadline = time.time() + args.timeout
+        pending = b""
+        while collector.saved < args.count and time.time() < deadline:
+            pending += port.read(4096)
+            *lines, pending = pending.split(b"\n")
+            for line in lines:
+                collector.feed(line.decode(errors="replace"))
+    if collector.saved < args.count:
+        print(f"shot: {collector.saved} of {args.count} captures within {args.timeout} s")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("log", nargs="?", help="saved serial output ('-' for stdin)")
+    parser.add_argument("--port", help="serial port to capture from")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--send", default="shot", help="command to send (default 'shot')")
+    parser.add_argument("--count", type=int, default=1, help="captures to wait for")
+    parser.add_argument("--timeout", type=float, default=30.0, help="seconds to wait for them")
+    parser.add_argument("--out", default=".", help="directory for the PNGs")
+    args = parser.parse_args()
+
+    if not args.port and not args.log:
+        parser.error("give --port or a log file")
+    os.makedirs(args.out, exist_ok=True)
+    collector = Collector(args.out)
+
+    if args.port:
+        from_port(args, collector)
+    else:
+        stream = sys.stdin if args.log == "-" else open(args.log, errors="replace")
+        for line in stream:
+            collector.feed(line)
+
+    return 0 if collector.saved > 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())